@@ -18,6 +18,9 @@ class PostgresBinaryCopyFunction : public CopyFunction {
 public:
 	PostgresBinaryCopyFunction();
 
+	//! The amount of encoded data a thread buffers before writing it to the file
+	static constexpr const idx_t FLUSH_SIZE = 1024 * 1024;
+
 	static unique_ptr<FunctionData> PostgresBinaryWriteBind(ClientContext &context, CopyFunctionBindInput &input,
 	                                                        const vector<string> &names,
 	                                                        const vector<LogicalType> &sql_types);
@@ -32,6 +35,15 @@ public:
 	                                       GlobalFunctionData &gstate, LocalFunctionData &lstate);
 	static void PostgresBinaryWriteFinalize(ClientContext &context, FunctionData &bind_data,
 	                                        GlobalFunctionData &gstate);
+	static CopyFunctionExecutionMode PostgresBinaryWriteExecutionMode(bool preserve_insertion_order,
+	                                                                  bool supports_batch_index);
+	static unique_ptr<PreparedBatchData> PostgresBinaryWritePrepareBatch(ClientContext &context,
+	                                                                     FunctionData &bind_data,
+	                                                                     GlobalFunctionData &gstate,
+	                                                                     unique_ptr<ColumnDataCollection> collection);
+	static void PostgresBinaryWriteFlushBatch(ClientContext &context, FunctionData &bind_data,
+	                                          GlobalFunctionData &gstate, PreparedBatchData &batch);
+	static idx_t PostgresBinaryWriteFileSize(GlobalFunctionData &gstate);
 };
 
 } // namespace duckdb
@@ -0,0 +1,115 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// postgres_binary_file_reader.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "postgres_binary_decoder.hpp"
+
+namespace duckdb {
+
+struct ReadPostgresBinaryBindData : public TableFunctionData {
+	//! The files to read
+	vector<string> files;
+	//! The types of the columns stored in the files
+	vector<LogicalType> types;
+	vector<PostgresType> postgres_types;
+	//! Uncompressed files larger than this are split into multiple ranges that are read in parallel
+	idx_t split_size = DEFAULT_SPLIT_SIZE;
+	//! Whether the files are read by COPY ... FROM (FORMAT postgres_binary) - in that case the files contain the
+	//! columns of the table, and they can be copied into Postgres tables without decoding them
+	bool copy_from = false;
+
+	//! The length of the binary representation of the values of every column, or -1 if the length is variable
+	vector<int32_t> GetFieldLengths() const;
+	//! The field lengths when the files are copied into columns with the given Postgres types
+	vector<int32_t> GetFieldLengths(const vector<PostgresType> &target_types) const;
+
+	static constexpr idx_t DEFAULT_SPLIT_SIZE = 32ULL * 1024ULL * 1024ULL;
+};
+
+struct ReadPostgresBinaryTask {
+	idx_t file_idx;
+	//! The byte range of the file - the task reads all tuples that start within the range
+	idx_t start;
+	idx_t end;
+	//! The size of the file if it is split, or DConstants::INVALID_INDEX if it is read as a whole
+	idx_t file_size;
+};
+
+//! Reads the tuples of a (range of a) Postgres binary COPY file
+class PostgresBinaryFileReader : public PostgresBinaryDecoder {
+public:
+	PostgresBinaryFileReader(ClientContext &context, const string &path, const ReadPostgresBinaryTask &task,
+	                         vector<int32_t> field_lengths);
+
+	//! The amount of consecutive tuples that have to be valid before a position in a split file is accepted
+	static constexpr idx_t VALIDATE_TUPLE_COUNT = 16;
+	static constexpr idx_t INITIAL_BUFFER_SIZE = 1024ULL * 1024ULL;
+
+	//! Splits the files into the tasks that are read in parallel
+	static vector<ReadPostgresBinaryTask> CreateTasks(ClientContext &context, const vector<string> &files,
+	                                                  idx_t split_size);
+
+	//! Decodes the next tuples into the output chunk
+	void Read(DataChunk &output, const vector<column_t> &column_ids, const ReadPostgresBinaryBindData &bind_data);
+	//! Copies the next tuples (up to approximately max_size bytes) without decoding them into row "row" of the BLOB
+	//! vector - returns the number of tuples
+	idx_t ReadRaw(Vector &output, idx_t row, idx_t max_size);
+
+	bool Finished() const {
+		return finished;
+	}
+
+private:
+	enum class TupleResult { TUPLE, TRAILER, INVALID, END_OF_FILE };
+
+	//! Makes sure the bytes [offset, offset + size) are in the buffer - returns false if the file ends before that
+	bool Ensure(idx_t offset, idx_t size);
+	data_ptr_t BufferPointer(idx_t offset) {
+		return buffer.data() + (offset - buffer_offset);
+	}
+	template <class T>
+	T ReadAt(idx_t offset) {
+		buffer_ptr = BufferPointer(offset);
+		end = buffer_ptr + sizeof(T);
+		return ReadIntegerUnchecked<T>();
+	}
+	//! Parses the tuple at the given offset, filling in the field offsets and the size of the tuple
+	TupleResult ParseTuple(idx_t offset, idx_t &tuple_size);
+	//! Parses the tuple at the current position - returns false if the end of the range has been reached
+	bool NextTuple(idx_t &tuple_size);
+	void ReadHeader();
+	//! Finds the first tuple that starts within the range of a split file
+	void FindTupleStart();
+
+private:
+	string path;
+	unique_ptr<FileHandle> handle;
+	idx_t column_count;
+	//! The length of the (non-NULL) values of every column, or -1 if the length is variable
+	//! In split files this rejects positions that only happen to look like the start of a tuple
+	vector<int32_t> field_lengths;
+	idx_t file_size;
+	//! The file offset of the next tuple
+	idx_t position;
+	//! Tuples that start at or after this offset belong to the next range
+	idx_t range_end;
+	bool finished = false;
+	//! The buffered data, starting at file offset buffer_offset
+	vector<data_t> buffer;
+	idx_t buffer_offset;
+	idx_t buffer_size = 0;
+	//! Data before this offset is no longer needed and can be discarded from the buffer
+	idx_t anchor;
+	bool end_of_file = false;
+	//! The file offsets of the fields of the last parsed tuple
+	vector<idx_t> field_offsets;
+};
+
+} // namespace duckdb
@@ -17,11 +17,11 @@ namespace duckdb {
 
 class PostgresBinaryWriter {
 public:
-	explicit PostgresBinaryWriter(PostgresCopyState &state) : state(state) {
+	explicit PostgresBinaryWriter(PostgresCopyState &state) : stream(state.buffer), state(state) {
 	}
 
 	template <class T>
-	T GetInteger(T val) {
+	static T GetInteger(T val) {
 		if (sizeof(T) == sizeof(uint8_t)) {
 			return val;
 		} else if (sizeof(T) == sizeof(uint16_t)) {
@@ -200,6 +200,13 @@ public:
 		}
 	}
 
+	void WriteCTID(row_t row_id) {
+		// a ctid consists of a 4-byte block number followed by a 2-byte offset within the block
+		WriteRawInteger<int32_t>(sizeof(uint32_t) + sizeof(uint16_t));
+		WriteRawInteger<uint32_t>(uint32_t(row_id >> 16));
+		WriteRawInteger<uint16_t>(uint16_t(row_id & 0xFFFF));
+	}
+
 	void WriteRawBlob(string_t value) {
 		auto str_size = value.GetSize();
 		auto str_data = value.GetData();
@@ -232,7 +239,31 @@ public:
 		WriteRawBlob(value);
 	}
 
-	void WriteArray(Vector &col, idx_t r, const vector<uint32_t> &dimensions, idx_t depth, uint32_t count) {
+	void WriteJSONB(string_t value) {
+		// jsonb is sent as a version number followed by the text representation
+		auto str_size = value.GetSize();
+		WriteRawInteger<int32_t>(NumericCast<int32_t>(str_size + 1));
+		WriteRawInteger<uint8_t>(1);
+		stream.WriteData(const_data_ptr_cast(value.GetData()), str_size);
+	}
+
+	//! Returns the oid of a value - uses the oid of the Postgres type if it is known
+	static uint32_t GetValueOid(const LogicalType &type, optional_ptr<const PostgresType> pg_type) {
+		if (pg_type && pg_type->oid != 0) {
+			return NumericCast<uint32_t>(pg_type->oid);
+		}
+		return PostgresUtils::ToPostgresOid(type);
+	}
+
+	static optional_ptr<const PostgresType> GetChildType(optional_ptr<const PostgresType> pg_type, idx_t child_idx) {
+		if (!pg_type || child_idx >= pg_type->children.size()) {
+			return nullptr;
+		}
+		return &pg_type->children[child_idx];
+	}
+
+	void WriteArray(Vector &col, idx_t r, const vector<uint32_t> &dimensions, idx_t depth, uint32_t count,
+	                optional_ptr<const PostgresType> element_type) {
 		auto list_data = FlatVector::GetData<list_entry_t>(col);
 		auto &child_vector = ListVector::GetEntry(col);
 		for (idx_t i = 0; i < count; i++) {
@@ -244,17 +275,52 @@ public:
 			}
 			if (child_vector.GetType().id() == LogicalTypeId::LIST) {
 				// multidimensional array - recurse
-				WriteArray(child_vector, list_entry.offset, dimensions, depth + 1, list_entry.length);
+				WriteArray(child_vector, list_entry.offset, dimensions, depth + 1, list_entry.length, element_type);
 			} else {
 				// write the actual values
 				for (idx_t child_idx = 0; child_idx < list_entry.length; child_idx++) {
-					WriteValue(child_vector, list_entry.offset + child_idx);
+					WriteValue(child_vector, list_entry.offset + child_idx, element_type);
 				}
 			}
 		}
 	}
 
-	void WriteValue(Vector &col, idx_t r) {
+	//! Writes all rows of a flattened chunk
+	//! Chunks that only contain simple types are encoded column-by-column into precomputed row positions
+	void WriteChunk(DataChunk &chunk) {
+		auto count = chunk.size();
+		auto &positions = state.row_positions;
+		auto &pg_types = state.postgres_types;
+		D_ASSERT(pg_types.empty() || pg_types.size() == chunk.ColumnCount());
+		if (!ComputeRowPositions(chunk, pg_types, positions)) {
+			for (idx_t r = 0; r < count; r++) {
+				BeginRow(chunk.ColumnCount());
+				for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+					WriteValue(chunk.data[c], r, pg_types.empty() ? nullptr : &pg_types[c]);
+				}
+				FinishRow();
+			}
+			return;
+		}
+		auto total_size = positions[count];
+		auto &buffer = state.chunk_buffer;
+		if (buffer.size() < total_size) {
+			buffer.resize(total_size);
+		}
+		auto target = buffer.data();
+		auto field_count = GetInteger<int16_t>(int16_t(chunk.ColumnCount()));
+		for (idx_t r = 0; r < count; r++) {
+			Store<int16_t>(field_count, target + positions[r]);
+			positions[r] += sizeof(int16_t);
+		}
+		for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+			EncodeColumn(chunk.data[c], count, target, positions.data());
+		}
+		stream.WriteData(target, total_size);
+	}
+
+	//! Writes a single value - "pg_type" is the Postgres type of the value, if known
+	void WriteValue(Vector &col, idx_t r, optional_ptr<const PostgresType> pg_type = nullptr) {
 		if (FlatVector::IsNull(col, r)) {
 			WriteNull();
 			return;
@@ -281,6 +347,12 @@ public:
 			WriteInteger<int64_t>(data);
 			break;
 		}
+		case LogicalTypeId::UINTEGER: {
+			// oid
+			auto data = FlatVector::GetData<uint32_t>(col)[r];
+			WriteInteger<uint32_t>(data);
+			break;
+		}
 		case LogicalTypeId::FLOAT: {
 			auto data = FlatVector::GetData<float>(col)[r];
 			WriteFloat(data);
@@ -344,7 +416,11 @@ public:
 		}
 		case LogicalTypeId::VARCHAR: {
 			auto data = FlatVector::GetData<string_t>(col)[r];
-			WriteVarchar(data);
+			if (pg_type && pg_type->info == PostgresTypeAnnotation::JSONB) {
+				WriteJSONB(data);
+			} else {
+				WriteVarchar(data);
+			}
 			break;
 		}
 		case LogicalTypeId::BLOB: {
@@ -374,7 +450,14 @@ public:
 		}
 		case LogicalTypeId::LIST: {
 			auto list_entry = FlatVector::GetData<list_entry_t>(col)[r];
-			auto value_oid = PostgresUtils::ToPostgresOid(ListType::GetChildType(type));
+			// find the element type of the (possibly multidimensional) array
+			const_reference<LogicalType> element_type = ListType::GetChildType(type);
+			auto element_pg_type = GetChildType(pg_type, 0);
+			while (element_type.get().id() == LogicalTypeId::LIST) {
+				element_type = ListType::GetChildType(element_type.get());
+				element_pg_type = GetChildType(element_pg_type, 0);
+			}
+			auto value_oid = GetValueOid(element_type.get(), element_pg_type);
 			if (list_entry.length == 0) {
 				// empty list
 				WriteRawInteger<int32_t>(sizeof(uint32_t) * 3);
@@ -407,7 +490,7 @@ public:
 				WriteRawInteger<uint32_t>(1);   // index lower bounds
 			}
 			// now recursively write the actual values
-			WriteArray(col, r, dimensions, 0, 1);
+			WriteArray(col, r, dimensions, 0, 1, element_pg_type);
 
 			// after writing all list elements update the field size
 			auto end_position = stream.GetPosition();
@@ -421,10 +504,11 @@ public:
 			auto start_position = stream.GetPosition();
 			WriteRawInteger<int32_t>(0);                     // data size (nop for now)
 			WriteRawInteger<uint32_t>(child_entries.size()); // column count
-			for (auto &child : child_entries) {
-				auto value_oid = PostgresUtils::ToPostgresOid(child->GetType());
-				WriteRawInteger<uint32_t>(value_oid); // value oid
-				WriteValue(*child, r);
+			for (idx_t c = 0; c < child_entries.size(); c++) {
+				auto &child = *child_entries[c];
+				auto child_pg_type = GetChildType(pg_type, c);
+				WriteRawInteger<uint32_t>(GetValueOid(child.GetType(), child_pg_type)); // value oid
+				WriteValue(child, r, child_pg_type);
 			}
 			auto end_position = stream.GetPosition();
 			// after writing all list elements update the field size
@@ -437,8 +521,188 @@ public:
 		}
 	}
 
+private:
+	//! The size of a (non-NULL) value of the given type, or 0 if the type is not fixed-size
+	static idx_t GetFixedSize(const LogicalType &type) {
+		switch (type.id()) {
+		case LogicalTypeId::BOOLEAN:
+			return sizeof(uint8_t);
+		case LogicalTypeId::SMALLINT:
+			return sizeof(int16_t);
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::FLOAT:
+		case LogicalTypeId::DATE:
+			return sizeof(int32_t);
+		case LogicalTypeId::BIGINT:
+		case LogicalTypeId::DOUBLE:
+		case LogicalTypeId::TIME:
+		case LogicalTypeId::TIMESTAMP:
+		case LogicalTypeId::TIMESTAMP_TZ:
+			return sizeof(int64_t);
+		case LogicalTypeId::INTERVAL:
+		case LogicalTypeId::UUID:
+			return sizeof(uint64_t) * 2;
+		default:
+			return 0;
+		}
+	}
+
+	//! Computes the start position of every row in the encoded chunk (followed by the total size)
+	//! Returns false if the chunk has to be written row-by-row
+	static bool ComputeRowPositions(DataChunk &chunk, const vector<PostgresType> &pg_types, vector<idx_t> &positions) {
+		auto count = chunk.size();
+		positions.resize(count + 1);
+		for (idx_t r = 0; r < count; r++) {
+			positions[r] = sizeof(int16_t);
+		}
+		for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
+			auto &col = chunk.data[c];
+			auto &type = col.GetType();
+			auto &validity = FlatVector::Validity(col);
+			auto fixed_size = GetFixedSize(type);
+			if (fixed_size > 0) {
+				for (idx_t r = 0; r < count; r++) {
+					positions[r] += sizeof(int32_t) + (validity.RowIsValid(r) ? fixed_size : 0);
+				}
+				continue;
+			}
+			if (type.id() != LogicalTypeId::VARCHAR && type.id() != LogicalTypeId::BLOB) {
+				return false;
+			}
+			if (!pg_types.empty() && pg_types[c].info == PostgresTypeAnnotation::JSONB) {
+				return false;
+			}
+			auto strings = FlatVector::GetData<string_t>(col);
+			for (idx_t r = 0; r < count; r++) {
+				positions[r] += sizeof(int32_t);
+				if (!validity.RowIsValid(r)) {
+					continue;
+				}
+				auto str_size = strings[r].GetSize();
+				if (type.id() == LogicalTypeId::VARCHAR && memchr(strings[r].GetData(), '\0', str_size) != nullptr) {
+					// NULL bytes are rejected or replaced by the row-by-row writer
+					return false;
+				}
+				positions[r] += str_size;
+			}
+		}
+		// convert the row sizes into row positions
+		idx_t total_size = 0;
+		for (idx_t r = 0; r < count; r++) {
+			auto row_size = positions[r];
+			positions[r] = total_size;
+			total_size += row_size;
+		}
+		positions[count] = total_size;
+		return true;
+	}
+
+	//! Writes a column of values - "write_value" writes a single value and returns its size
+	template <class T, class FUNC>
+	static void WriteColumn(Vector &col, idx_t count, data_ptr_t target, idx_t positions[], FUNC write_value) {
+		auto data = FlatVector::GetData<T>(col);
+		auto &validity = FlatVector::Validity(col);
+		for (idx_t r = 0; r < count; r++) {
+			auto field_ptr = target + positions[r];
+			if (!validity.RowIsValid(r)) {
+				Store<int32_t>(GetInteger<int32_t>(-1), field_ptr);
+				positions[r] += sizeof(int32_t);
+				continue;
+			}
+			idx_t value_size = write_value(data[r], field_ptr + sizeof(int32_t));
+			Store<int32_t>(GetInteger<int32_t>(int32_t(value_size)), field_ptr);
+			positions[r] += sizeof(int32_t) + value_size;
+		}
+	}
+
+	template <class T>
+	static void WriteIntegerColumn(Vector &col, idx_t count, data_ptr_t target, idx_t positions[]) {
+		WriteColumn<T>(col, count, target, positions, [](T value, data_ptr_t ptr) {
+			Store<T>(GetInteger<T>(value), ptr);
+			return idx_t(sizeof(T));
+		});
+	}
+
+	static void EncodeColumn(Vector &col, idx_t count, data_ptr_t target, idx_t positions[]) {
+		switch (col.GetType().id()) {
+		case LogicalTypeId::BOOLEAN:
+			WriteColumn<bool>(col, count, target, positions, [](bool value, data_ptr_t ptr) {
+				Store<uint8_t>(value ? 1 : 0, ptr);
+				return idx_t(sizeof(uint8_t));
+			});
+			break;
+		case LogicalTypeId::SMALLINT:
+			WriteIntegerColumn<int16_t>(col, count, target, positions);
+			break;
+		case LogicalTypeId::INTEGER:
+			WriteIntegerColumn<int32_t>(col, count, target, positions);
+			break;
+		case LogicalTypeId::BIGINT:
+			WriteIntegerColumn<int64_t>(col, count, target, positions);
+			break;
+		case LogicalTypeId::FLOAT:
+			WriteColumn<float>(col, count, target, positions, [](float value, data_ptr_t ptr) {
+				Store<uint32_t>(GetInteger<uint32_t>(Load<uint32_t>(const_data_ptr_cast(&value))), ptr);
+				return idx_t(sizeof(uint32_t));
+			});
+			break;
+		case LogicalTypeId::DOUBLE:
+			WriteColumn<double>(col, count, target, positions, [](double value, data_ptr_t ptr) {
+				Store<uint64_t>(GetInteger<uint64_t>(Load<uint64_t>(const_data_ptr_cast(&value))), ptr);
+				return idx_t(sizeof(uint64_t));
+			});
+			break;
+		case LogicalTypeId::DATE:
+			WriteColumn<date_t>(col, count, target, positions, [](date_t value, data_ptr_t ptr) {
+				Store<uint32_t>(GetInteger<uint32_t>(DuckDBDateToPostgres(value)), ptr);
+				return idx_t(sizeof(uint32_t));
+			});
+			break;
+		case LogicalTypeId::TIME:
+			WriteColumn<dtime_t>(col, count, target, positions, [](dtime_t value, data_ptr_t ptr) {
+				Store<uint64_t>(GetInteger<uint64_t>(uint64_t(value.micros)), ptr);
+				return idx_t(sizeof(uint64_t));
+			});
+			break;
+		case LogicalTypeId::TIMESTAMP:
+		case LogicalTypeId::TIMESTAMP_TZ:
+			WriteColumn<timestamp_t>(col, count, target, positions, [](timestamp_t value, data_ptr_t ptr) {
+				Store<uint64_t>(GetInteger<uint64_t>(DuckDBTimestampToPostgres(value)), ptr);
+				return idx_t(sizeof(uint64_t));
+			});
+			break;
+		case LogicalTypeId::INTERVAL:
+			WriteColumn<interval_t>(col, count, target, positions, [](interval_t value, data_ptr_t ptr) {
+				Store<uint64_t>(GetInteger<uint64_t>(uint64_t(value.micros)), ptr);
+				Store<uint32_t>(GetInteger<uint32_t>(uint32_t(value.days)), ptr + sizeof(uint64_t));
+				Store<uint32_t>(GetInteger<uint32_t>(uint32_t(value.months)),
+				                ptr + sizeof(uint64_t) + sizeof(uint32_t));
+				return idx_t(sizeof(uint64_t) + sizeof(uint32_t) * 2);
+			});
+			break;
+		case LogicalTypeId::UUID:
+			WriteColumn<hugeint_t>(col, count, target, positions, [](hugeint_t value, data_ptr_t ptr) {
+				Store<uint64_t>(GetInteger<uint64_t>(uint64_t(value.upper) ^ uint64_t(1) << 63), ptr);
+				Store<uint64_t>(GetInteger<uint64_t>(value.lower), ptr + sizeof(uint64_t));
+				return idx_t(sizeof(uint64_t) * 2);
+			});
+			break;
+		case LogicalTypeId::VARCHAR:
+		case LogicalTypeId::BLOB:
+			WriteColumn<string_t>(col, count, target, positions, [](const string_t &value, data_ptr_t ptr) {
+				auto str_size = value.GetSize();
+				memcpy(ptr, value.GetData(), str_size);
+				return idx_t(str_size);
+			});
+			break;
+		default:
+			throw InternalException("Unsupported type \"%s\" for column-wise Postgres binary copy", col.GetType());
+		}
+	}
+
 public:
-	MemoryStream stream;
+	//! The buffer of the COPY state - data is appended to any data that has not been sent yet
+	MemoryStream &stream;
 	PostgresCopyState &state;
 };
 
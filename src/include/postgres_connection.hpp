@@ -44,13 +44,22 @@ public:
 	PostgresConnection &operator=(PostgresConnection &&) noexcept;
 
 public:
+	//! The amount of encoded COPY data that is batched into a single message
+	static constexpr const idx_t COPY_BUFFER_SIZE = 256 * 1024;
+
 	static PostgresConnection Open(const string &connection_string);
+	//! Opens "count" connections to the same database concurrently
+	static vector<PostgresConnection> OpenParallel(const string &connection_string, idx_t count);
 	void Execute(const string &query);
 	unique_ptr<PostgresResult> TryQuery(const string &query, optional_ptr<string> error_message = nullptr);
 	unique_ptr<PostgresResult> Query(const string &query);
 
 	//! Submits a set of queries to be executed in the connection.
 	vector<unique_ptr<PostgresResult>> ExecuteQueries(const string &queries);
+	//! Prepares "query" and executes it once for every tuple in "tuples" (encoded as binary COPY rows), binding the
+	//! fields of the tuple as binary parameters. All statements are sent in a single round trip using pipeline mode.
+	//! Returns the total amount of affected rows
+	idx_t ExecutePipelined(const string &query, const_data_ptr_t tuples, idx_t size);
 
 	PostgresVersion GetPostgresVersion();
 
@@ -61,13 +70,27 @@ public:
 	void CopyData(data_ptr_t buffer, idx_t size);
 	void CopyData(PostgresBinaryWriter &writer);
 	void CopyData(PostgresTextWriter &writer);
+	//! Sends the buffered data of the COPY once enough has accumulated (or when "force" is set)
+	//! Sending happens in the background - the next batch can be encoded while the previous one is being sent
+	void FlushCopyData(PostgresCopyState &state, bool force = false);
 	void CopyChunk(ClientContext &context, PostgresCopyState &state, DataChunk &chunk, DataChunk &varchar_chunk);
 	void FinishCopyTo(PostgresCopyState &state);
 
 	void BeginCopyFrom(const string &query, ExecStatusType expected_result);
 
+private:
+	//! Waits until all data queued in libpq has been sent to the server
+	void FlushOutput();
+
+public:
 	bool IsOpen();
 	void Close();
+	//! Checks whether the connection is still alive using a single (empty) round-trip to the server
+	bool Ping();
+	//! Re-establishes the connection to the server, returns whether or not the reset succeeded
+	bool Reset();
+	//! Requests the server to cancel the query that is currently running on this connection
+	void Cancel();
 
 	shared_ptr<OwnedPostgresConnection> GetConnection() {
 		return connection;
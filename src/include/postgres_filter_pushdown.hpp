@@ -18,6 +18,7 @@ class PostgresFilterPushdown {
 public:
 	static string TransformFilters(const vector<column_t> &column_ids, optional_ptr<TableFilterSet> filters,
 	                               const vector<string> &names);
+	static string TransformLiteral(const Value &val);
 
 private:
 	static string TransformCTIDLiteral(const Value &val);
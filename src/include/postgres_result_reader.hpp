@@ -19,6 +19,25 @@ struct PostgresBindData;
 
 enum class PostgresReadResult { FINISHED, HAVE_MORE_TUPLES };
 
+//! Counters collected while reading results from Postgres
+struct PostgresReadStatistics {
+	idx_t rows = 0;
+	idx_t bytes_received = 0;
+	idx_t copy_messages = 0;
+	//! Time spent blocked waiting for the server in nanoseconds
+	idx_t network_wait_time = 0;
+	//! Time spent decoding the received data in nanoseconds
+	idx_t decode_time = 0;
+
+	void Merge(const PostgresReadStatistics &other) {
+		rows += other.rows;
+		bytes_received += other.bytes_received;
+		copy_messages += other.copy_messages;
+		network_wait_time += other.network_wait_time;
+		decode_time += other.decode_time;
+	}
+};
+
 struct PostgresResultReader {
 	explicit PostgresResultReader(PostgresConnection &con_p, const vector<column_t> &column_ids,
 	                              const PostgresBindData &bind_data)
@@ -29,6 +48,9 @@ struct PostgresResultReader {
 	PostgresConnection &GetConn() {
 		return con;
 	}
+	PostgresReadStatistics &GetStatistics() {
+		return stats;
+	}
 
 public:
 	virtual void BeginCopy(const string &sql) = 0;
@@ -38,6 +60,7 @@ protected:
 	PostgresConnection &con;
 	const vector<column_t> &column_ids;
 	const PostgresBindData &bind_data;
+	PostgresReadStatistics stats;
 };
 
 } // namespace duckdb
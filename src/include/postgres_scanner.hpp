@@ -18,6 +18,11 @@ class PostgresCatalog;
 struct PostgresLocalState;
 struct PostgresGlobalState;
 class PostgresTransaction;
+struct CopyFromFunctionBindInput;
+class TableFilterSet;
+
+//! The largest page number that can be expressed in a ctid
+static constexpr uint32_t POSTGRES_TID_MAX = 4294967295;
 
 struct PostgresBindData : public FunctionData {
 	static constexpr const idx_t DEFAULT_PAGES_PER_TASK = 1000;
@@ -30,6 +35,8 @@ public:
 	string table_name;
 	string sql;
 	string limit;
+	//! An additional filter (a SQL expression) that the scanned rows of the table must satisfy
+	string table_filter;
 	idx_t pages_approx = 0;
 
 	vector<PostgresType> postgres_types;
@@ -38,6 +45,8 @@ public:
 
 	idx_t pages_per_task = DEFAULT_PAGES_PER_TASK;
 	string dsn;
+	//! The connection pool used by stand-alone scans (i.e. scans that are not bound to an attached catalog)
+	shared_ptr<PostgresConnectionPool> connection_pool;
 
 	bool requires_materialization = true;
 	bool can_use_main_thread = true;
@@ -82,6 +91,16 @@ public:
 
 	static void PrepareBind(PostgresVersion version, ClientContext &context, PostgresBindData &bind,
 	                        idx_t approx_num_pages);
+	//! Returns the COPY query that reads the pages [task_min, task_max] of the given columns
+	static string GetScanQuery(const PostgresBindData &bind_data, const vector<column_t> &column_ids,
+	                           optional_ptr<TableFilterSet> filters, idx_t task_min, idx_t task_max);
+	//! Exports the snapshot of the transaction running on the connection - returns an empty string if the server does
+	//! not support sharing snapshots
+	static string ExportSnapshot(PostgresVersion version, PostgresConnection &con);
+	//! Starts a read-only scan transaction, optionally importing a snapshot that was exported by another connection
+	static void BeginScanTransaction(PostgresConnection &con, const string &snapshot);
+	//! Ends the scan transaction of a pooled connection so that it can be handed out by the pool again
+	static void EndScanTransaction(PostgresPoolConnection &pool_connection);
 };
 
 class PostgresScanFunctionFilterPushdown : public TableFunction {
@@ -97,6 +116,11 @@ public:
 	static void ClearPostgresCaches(ClientContext &context);
 };
 
+class PostgresPoolStatsFunction : public TableFunction {
+public:
+	PostgresPoolStatsFunction();
+};
+
 class PostgresQueryFunction : public TableFunction {
 public:
 	PostgresQueryFunction();
@@ -107,4 +131,39 @@ public:
 	PostgresExecuteFunction();
 };
 
+class PostgresScanChangesFunction : public TableFunction {
+public:
+	PostgresScanChangesFunction();
+};
+
+class PostgresChangeWatermarkFunction : public TableFunction {
+public:
+	PostgresChangeWatermarkFunction();
+
+	//! Returns the oldest transaction id that was still running at the start of the current snapshot - all rows
+	//! written by a later transaction have an xmin that is equal to or newer than this watermark
+	static idx_t GetWatermark(PostgresVersion version, PostgresConnection &con);
+};
+
+class PostgresCopyDatabaseFunction : public TableFunction {
+public:
+	PostgresCopyDatabaseFunction();
+};
+
+class PostgresReplicateFunction : public TableFunction {
+public:
+	PostgresReplicateFunction();
+};
+
+class PostgresReadBinaryFunction : public TableFunction {
+public:
+	PostgresReadBinaryFunction();
+
+	//! COPY ... FROM ... (FORMAT postgres_binary)
+	static unique_ptr<FunctionData> PostgresBinaryCopyFromBind(ClientContext &context,
+	                                                           CopyFromFunctionBindInput &input,
+	                                                           vector<string> &expected_names,
+	                                                           vector<LogicalType> &expected_types);
+};
+
 } // namespace duckdb
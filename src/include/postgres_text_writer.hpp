@@ -17,7 +17,7 @@ namespace duckdb {
 
 class PostgresTextWriter {
 public:
-	explicit PostgresTextWriter(PostgresCopyState &state) : state(state) {
+	explicit PostgresTextWriter(PostgresCopyState &state) : stream(state.buffer), state(state) {
 	}
 
 	void WriteNull() {
@@ -78,12 +78,62 @@ public:
 		}
 	}
 
+	//! Whether the character has to be escaped by WriteChar
+	static bool NeedsEscape(char c) {
+		switch (c) {
+		case '\n':
+		case '\r':
+		case '\b':
+		case '\f':
+		case '\t':
+		case '\v':
+		case '\\':
+		case '"':
+		case '\0':
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	//! Whether any of the bytes of the word might have to be escaped - this checks eight bytes at a time for
+	//! control characters below 0x0E, double quotes and backslashes (see "Bit Twiddling Hacks")
+	static bool MightNeedEscape(uint64_t word) {
+		static constexpr uint64_t ONES = 0x0101010101010101ULL;
+		static constexpr uint64_t HIGH_BITS = 0x8080808080808080ULL;
+		auto quotes = word ^ (ONES * uint64_t('"'));
+		auto backslashes = word ^ (ONES * uint64_t('\\'));
+		auto has_control = (word - ONES * 0x0EULL) & ~word & HIGH_BITS;
+		auto has_quote = (quotes - ONES) & ~quotes & HIGH_BITS;
+		auto has_backslash = (backslashes - ONES) & ~backslashes & HIGH_BITS;
+		return (has_control | has_quote | has_backslash) != 0;
+	}
+
 	void WriteVarchar(string_t value) {
 		auto size = value.GetSize();
 		auto data = value.GetData();
-		for (idx_t c = 0; c < size; c++) {
-			WriteChar(data[c]);
+		// runs of characters that do not need escaping are written at once
+		idx_t run_start = 0;
+		idx_t pos = 0;
+		while (pos < size) {
+			// skip over words without any characters that need escaping
+			while (pos + sizeof(uint64_t) <= size) {
+				if (MightNeedEscape(Load<uint64_t>(const_data_ptr_cast(data + pos)))) {
+					break;
+				}
+				pos += sizeof(uint64_t);
+			}
+			auto word_end = MinValue<idx_t>(pos + sizeof(uint64_t), size);
+			for (; pos < word_end; pos++) {
+				if (!NeedsEscape(data[pos])) {
+					continue;
+				}
+				stream.WriteData(const_data_ptr_cast(data + run_start), pos - run_start);
+				WriteChar(data[pos]);
+				run_start = pos + 1;
+			}
 		}
+		stream.WriteData(const_data_ptr_cast(data + run_start), size - run_start);
 	}
 
 	void WriteValue(Vector &col, idx_t r) {
@@ -110,7 +160,8 @@ public:
 	}
 
 public:
-	MemoryStream stream;
+	//! The buffer of the COPY state - data is appended to any data that has not been sent yet
+	MemoryStream &stream;
 	PostgresCopyState &state;
 };
 
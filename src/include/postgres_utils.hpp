@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
 #include <libpq-fe.h>
 #include "postgres_version.hpp"
 
@@ -20,6 +21,9 @@ struct PostgresTypeData {
 	int64_t type_modifier = 0;
 	string type_name;
 	idx_t array_dimensions = 0;
+	//! The oid of the type and (for arrays) of the element type, if known
+	idx_t type_oid = 0;
+	idx_t element_oid = 0;
 };
 
 enum class PostgresTypeAnnotation {
@@ -50,6 +54,13 @@ struct PostgresCopyState {
 	PostgresCopyFormat format = PostgresCopyFormat::AUTO;
 	bool has_null_byte_replacement = false;
 	string null_byte_replacement;
+	//! The Postgres types of the copied columns (if known) - used to write the element oids of arrays and composites
+	vector<PostgresType> postgres_types;
+	//! The encoded data that has not been sent yet - reused for the entire COPY
+	MemoryStream buffer;
+	//! Scratch space used to encode chunks column-by-column
+	vector<idx_t> row_positions;
+	vector<data_t> chunk_buffer;
 
 	void Initialize(ClientContext &context);
 };
@@ -59,6 +70,12 @@ enum class PostgresIsolationLevel { READ_COMMITTED, REPEATABLE_READ, SERIALIZABL
 class PostgresUtils {
 public:
 	static PGconn *PGConnect(const string &dsn);
+	//! Opens "count" connections concurrently using the non-blocking connection API
+	static vector<PGconn *> PGConnectParallel(const string &dsn, idx_t count);
+	//! Waits until data can be read from the connection - returns false if the timeout expired first
+	static bool PGWaitForInput(PGconn *conn, int timeout_ms);
+	//! Waits until data can be written to (or read from) the connection - returns false if the timeout expired first
+	static bool PGWaitForOutput(PGconn *conn, int timeout_ms);
 
 	static LogicalType ToPostgresType(const LogicalType &input);
 	static LogicalType TypeToLogicalType(optional_ptr<PostgresTransaction> transaction,
@@ -71,6 +88,8 @@ public:
 	static LogicalType RemoveAlias(const LogicalType &type);
 	static PostgresType CreateEmptyPostgresType(const LogicalType &type);
 	static string QuotePostgresIdentifier(const string &text);
+	//! Quotes a value for use in a key-value connection string
+	static string EscapeConnectionString(const string &input);
 
 	static PostgresVersion ExtractPostgresVersion(const string &version);
 };
@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// storage/postgres_binary_file_scan.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+struct ReadPostgresBinaryBindData;
+
+//! Reads Postgres binary COPY files without decoding them - every row holds a batch of raw tuples (BLOB) and the
+//! number of tuples in the batch (BIGINT), which PostgresInsert copies into the table as-is
+class PostgresBinaryFileScan : public PhysicalOperator {
+public:
+	PostgresBinaryFileScan(PhysicalPlan &physical_plan, const ReadPostgresBinaryBindData &bind_data,
+	                       vector<int32_t> field_lengths, idx_t estimated_cardinality);
+
+	//! The (approximate) amount of tuple data in a single row
+	static constexpr const idx_t BATCH_SIZE = 1024 * 1024;
+
+	//! The files to read
+	vector<string> files;
+	//! The length of the values of every column in the files, or -1 if the length is variable
+	vector<int32_t> field_lengths;
+	//! Uncompressed files larger than this are split into multiple ranges that are read in parallel
+	idx_t split_size;
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
+	                                                 GlobalSourceState &gstate) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+	bool ParallelSource() const override {
+		return true;
+	}
+
+	string GetName() const override;
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+} // namespace duckdb
@@ -21,13 +21,16 @@ class PostgresSchemaEntry;
 class PostgresCatalog : public Catalog {
 public:
 	explicit PostgresCatalog(AttachedDatabase &db_p, string connection_string, string attach_path,
-	                         AccessMode access_mode, string schema_to_load, PostgresIsolationLevel isolation_level);
+	                         AccessMode access_mode, string schema_to_load, PostgresIsolationLevel isolation_level,
+	                         idx_t min_connections = 0);
 	~PostgresCatalog();
 
 	string connection_string;
 	string attach_path;
 	AccessMode access_mode;
 	PostgresIsolationLevel isolation_level;
+	//! The number of connections that are opened up-front when attaching
+	idx_t min_connections;
 
 public:
 	void Initialize(bool load_builtin) override;
@@ -78,7 +81,7 @@ public:
 	string GetDBPath() override;
 
 	PostgresConnectionPool &GetConnectionPool() {
-		return connection_pool;
+		return *connection_pool;
 	}
 
 	void ClearCache();
@@ -103,7 +106,8 @@ private:
 private:
 	PostgresVersion version;
 	PostgresSchemaSet schemas;
-	PostgresConnectionPool connection_pool;
+	//! The connection pool - shared with all other users of the same connection string
+	shared_ptr<PostgresConnectionPool> connection_pool;
 	string default_schema;
 };
 
@@ -9,12 +9,16 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/thread.hpp"
 #include "postgres_connection.hpp"
 
+#include <chrono>
+#include <condition_variable>
+
 namespace duckdb {
-class PostgresCatalog;
 class PostgresConnectionPool;
 
 class PostgresPoolConnection {
@@ -37,31 +41,106 @@ private:
 	PostgresConnection connection;
 };
 
+struct PostgresCachedConnection {
+	explicit PostgresCachedConnection(PostgresConnection connection);
+
+	PostgresConnection connection;
+	//! The last time the connection was returned to the pool
+	std::chrono::steady_clock::time_point last_used;
+	//! The last time the connection was used or verified to be alive
+	std::chrono::steady_clock::time_point last_checked;
+};
+
+struct PostgresConnectionPoolStatistics {
+	idx_t active_connections = 0;
+	idx_t idle_connections = 0;
+	idx_t maximum_connections = 0;
+	//! The total number of connections opened by the pool
+	idx_t connections_created = 0;
+	//! The number of broken connections that were re-established by the background maintenance
+	idx_t connections_reset = 0;
+	//! The number of failed connection attempts
+	idx_t connection_failures = 0;
+	//! The number of times a connection was requested from the pool
+	idx_t connection_requests = 0;
+	//! The total time spent waiting for a connection in microseconds
+	idx_t total_wait_time = 0;
+	//! The (approximate) 99th percentile of the time spent waiting for a connection in microseconds
+	idx_t p99_wait_time = 0;
+};
+
 class PostgresConnectionPool {
 public:
 	static constexpr const idx_t DEFAULT_MAX_CONNECTIONS = 64;
+	static constexpr const idx_t DEFAULT_IDLE_TIMEOUT = 600;
+	static constexpr const idx_t DEFAULT_HEALTH_CHECK_INTERVAL = 30;
 
-	PostgresConnectionPool(PostgresCatalog &postgres_catalog, idx_t maximum_connections = DEFAULT_MAX_CONNECTIONS);
+	explicit PostgresConnectionPool(string connection_string, idx_t maximum_connections = DEFAULT_MAX_CONNECTIONS);
+	~PostgresConnectionPool();
 
 public:
+	//! Returns the process-wide connection pool for the given connection string, creating it if it does not exist
+	//! Connection strings that describe the same set of connection options share a pool
+	//! A shared pool is limited to the largest maximum connection count requested by any of its users
+	static shared_ptr<PostgresConnectionPool> GetPool(const string &connection_string,
+	                                                  idx_t maximum_connections = DEFAULT_MAX_CONNECTIONS);
+	//! Returns all connection pools that are currently in use in this process
+	static vector<shared_ptr<PostgresConnectionPool>> GetPools();
+	//! Normalizes a connection string (key-value or URI) into a canonical key-value string
+	static string NormalizeConnectionString(const string &connection_string, bool include_password = true);
+	//! The normalized connection string of the pool without the password - safe to display
+	string GetDisplayConnectionString();
+
 	bool TryGetConnection(PostgresPoolConnection &connection);
 	PostgresPoolConnection GetConnection();
 	//! Always returns a connection - even if the connection slots are exhausted
 	PostgresPoolConnection ForceGetConnection();
 	void ReturnConnection(PostgresConnection connection);
+	//! Sets the maximum connection count - used when pg_connection_limit is changed explicitly
 	void SetMaximumConnections(idx_t new_max);
+	//! Raises the maximum connection count to "new_max" - a lower value than the current maximum is ignored
+	void RequestMaximumConnections(idx_t new_max);
+	//! Concurrently opens new connections until (at least) "count" idle connections are cached
+	//! The number of connections opened is bounded by the maximum connection count
+	void WarmUp(idx_t count);
+	//! Raises the number of idle connections the background maintenance keeps open to "new_min"
+	//! The pool keeps the largest minimum requested by any of the catalogs sharing it
+	void RequestMinimumConnections(idx_t new_min);
+	PostgresConnectionPoolStatistics GetStatistics();
 
 	static void PostgresSetConnectionCache(ClientContext &context, SetScope scope, Value &parameter);
+	static void PostgresSetIdleTimeout(ClientContext &context, SetScope scope, Value &parameter);
+	static void PostgresSetHealthCheckInterval(ClientContext &context, SetScope scope, Value &parameter);
+	static void PostgresSetKeepAliveIdle(ClientContext &context, SetScope scope, Value &parameter);
 
 private:
-	PostgresCatalog &postgres_catalog;
+	string connection_string;
 	mutex connection_lock;
 	idx_t active_connections;
 	idx_t maximum_connections;
-	vector<PostgresConnection> connection_cache;
+	idx_t minimum_connections;
+	vector<PostgresCachedConnection> connection_cache;
+	//! Background thread that expires idle connections and verifies cached connections are still alive
+	thread maintenance_thread;
+	std::condition_variable maintenance_cv;
+	bool shutdown;
+
+	//! Statistics - bucket "i" of the wait histogram counts waits of less than 2^i microseconds
+	static constexpr const idx_t WAIT_HISTOGRAM_BUCKETS = 32;
+	atomic<idx_t> connections_created;
+	atomic<idx_t> connections_reset;
+	atomic<idx_t> connection_failures;
+	atomic<idx_t> connection_requests;
+	atomic<idx_t> total_wait_time;
+	atomic<idx_t> wait_histogram[WAIT_HISTOGRAM_BUCKETS];
 
 private:
-	PostgresPoolConnection GetConnectionInternal();
+	PostgresPoolConnection GetConnectionInternal(unique_lock<mutex> &lock);
+	//! The connection string used for new connections, including any keep-alive options
+	string GetConnectionString();
+	void RecordWait(std::chrono::steady_clock::time_point start);
+	void MaintenanceLoop();
+	void RunMaintenance();
 };
 
 } // namespace duckdb
@@ -16,6 +16,9 @@ class PostgresDelete : public PhysicalOperator {
 public:
 	PostgresDelete(PhysicalPlan &physical_plan, LogicalOperator &op, TableCatalogEntry &table, idx_t row_id_index);
 
+	//! The amount of row ids above which they are streamed into a temporary table using a binary COPY
+	static constexpr idx_t DELETE_BATCH_SIZE = 8192;
+
 	//! The table to delete from
 	TableCatalogEntry &table;
 	idx_t row_id_index;
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// storage/postgres_dml_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+class PostgresCatalog;
+class PhysicalPlanGenerator;
+class LogicalCreateTable;
+class LogicalDelete;
+class LogicalInsert;
+class LogicalUpdate;
+
+//! Executes a single data-modifying statement in Postgres and returns the number of affected rows
+class PostgresRemoteDML : public PhysicalOperator {
+public:
+	PostgresRemoteDML(PhysicalPlan &physical_plan, vector<LogicalType> types, PostgresCatalog &catalog, string name,
+	                  string table_name, string sql);
+
+	PostgresCatalog &catalog;
+	//! The name of the operator (e.g. PG_REMOTE_DELETE)
+	string name;
+	//! The table that is modified
+	string table_name;
+	//! The statement to execute
+	string sql;
+	//! The table that is created before the statement is executed, in case of CREATE TABLE AS
+	optional_ptr<SchemaCatalogEntry> schema;
+	unique_ptr<BoundCreateTableInfo> info;
+
+public:
+	// Source interface
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+
+	string GetName() const override;
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+};
+
+class PostgresDMLPushdown {
+public:
+	//! Plans a DELETE as a single DELETE statement executed by Postgres
+	//! Returns nullptr if the DELETE cannot be fully expressed in Postgres (e.g. it contains non-translatable filters)
+	static optional_ptr<PhysicalOperator> TryPlanDelete(ClientContext &context, PhysicalPlanGenerator &planner,
+	                                                    LogicalDelete &op);
+	//! Plans an UPDATE as a single UPDATE statement executed by Postgres
+	//! Returns nullptr if the UPDATE cannot be fully expressed in Postgres
+	static optional_ptr<PhysicalOperator> TryPlanUpdate(ClientContext &context, PhysicalPlanGenerator &planner,
+	                                                    LogicalUpdate &op);
+	//! Plans an INSERT ... SELECT as a single INSERT ... SELECT statement executed by Postgres
+	//! Returns nullptr if the source of the INSERT is not a (filtered) scan of a table in the same database
+	static optional_ptr<PhysicalOperator> TryPlanInsert(ClientContext &context, PhysicalPlanGenerator &planner,
+	                                                    LogicalInsert &op);
+	//! Plans a CREATE TABLE AS as a CREATE TABLE followed by an INSERT ... SELECT statement executed by Postgres
+	//! Returns nullptr if the source of the CREATE TABLE AS is not a (filtered) scan of a table in the same database
+	static optional_ptr<PhysicalOperator> TryPlanCreateTableAs(ClientContext &context, PhysicalPlanGenerator &planner,
+	                                                           LogicalCreateTable &op);
+	//! Translates the ON CONFLICT clause of an INSERT into Postgres SQL, and returns the (quoted) conflict target
+	//! Throws an exception if the clause cannot be expressed in Postgres
+	static string TransformOnConflict(ClientContext &context, LogicalInsert &op, vector<string> &conflict_columns);
+};
+
+} // namespace duckdb
@@ -22,6 +22,9 @@ public:
 	PostgresInsert(PhysicalPlan &physical_plan, LogicalOperator &op, SchemaCatalogEntry &schema,
 	               unique_ptr<BoundCreateTableInfo> info);
 
+	//! The number of rows that are staged before an upsert is merged into the table
+	static constexpr idx_t UPSERT_BATCH_SIZE = 1000000;
+
 	//! The table to insert into
 	optional_ptr<TableCatalogEntry> table;
 	//! Table schema, in case of CREATE TABLE AS
@@ -32,6 +35,27 @@ public:
 	physical_index_vector_t<idx_t> column_index_map;
 	//! Whether or not we can keep the copy alive during Sink calls
 	bool keep_copy_alive = true;
+	//! The maximum amount of connections used to write data in parallel (1 = write over the transaction connection)
+	idx_t insert_connections = 1;
+	//! Whether or not parallel writers are committed using a two-phase commit
+	bool two_phase_commit = false;
+	//! The ON CONFLICT clause of an upsert - the data is staged in a temporary table and merged from there
+	string on_conflict_clause;
+	//! The (quoted) conflict target of the upsert
+	vector<string> conflict_columns;
+	//! Whether conflicting rows are updated (DO UPDATE) or skipped (DO NOTHING)
+	bool on_conflict_update = false;
+	//! The amount of rows below which the insert is executed as pipelined prepared statements (0 to disable)
+	idx_t small_dml_threshold = 0;
+	//! Whether CREATE TABLE AS and INSERT into an empty table load into an UNLOGGED table without indexes - the
+	//! indexes and constraints are (re)built after all rows have been copied
+	bool bulk_load = false;
+	//! Whether the table is made LOGGED again after a bulk load
+	bool bulk_load_set_logged = true;
+	//! Whether the table is analyzed after a bulk load
+	bool bulk_load_analyze = true;
+	//! Whether the input consists of raw binary COPY tuples (see PostgresBinaryFileScan) that are copied as-is
+	bool raw_copy = false;
 
 public:
 	// Source interface
@@ -44,7 +68,9 @@ public:
 public:
 	// Sink interface
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
 
@@ -53,7 +79,7 @@ public:
 	}
 
 	bool ParallelSink() const override {
-		return false;
+		return insert_connections > 1;
 	}
 
 	string GetName() const override;
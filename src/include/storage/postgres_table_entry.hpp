@@ -55,6 +55,8 @@ public:
 
 	//! Get the copy format (text or binary) that should be used when writing data to this table
 	PostgresCopyFormat GetCopyFormat(ClientContext &context);
+	//! Get the copy format that should be used when writing only the given columns
+	PostgresCopyFormat GetCopyFormat(ClientContext &context, const vector<PhysicalIndex> &column_ids);
 
 public:
 	//! Postgres type annotations
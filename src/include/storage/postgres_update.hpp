@@ -26,6 +26,8 @@ public:
 	vector<unique_ptr<Expression>> expressions;
 	//! Whether or not we can keep the copy alive during Sink calls
 	bool keep_copy_alive = true;
+	//! The amount of rows below which the update is executed as pipelined prepared statements (0 to disable)
+	idx_t small_dml_threshold = 0;
 
 public:
 	// Source interface
@@ -1,7 +1,9 @@
 #include "postgres_binary_copy.hpp"
 #include "postgres_binary_writer.hpp"
+#include "postgres_scanner.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 
 namespace duckdb {
 
@@ -12,6 +14,13 @@ PostgresBinaryCopyFunction::PostgresBinaryCopyFunction() : CopyFunction("postgre
 	copy_to_sink = PostgresBinaryWriteSink;
 	copy_to_combine = PostgresBinaryWriteCombine;
 	copy_to_finalize = PostgresBinaryWriteFinalize;
+	execution_mode = PostgresBinaryWriteExecutionMode;
+	prepare_batch = PostgresBinaryWritePrepareBatch;
+	flush_batch = PostgresBinaryWriteFlushBatch;
+	file_size_bytes = PostgresBinaryWriteFileSize;
+	copy_from_bind = PostgresReadBinaryFunction::PostgresBinaryCopyFromBind;
+	copy_from_function = PostgresReadBinaryFunction();
+	extension = "bin";
 }
 
 struct PostgresBinaryCopyGlobalState : public GlobalFunctionData {
@@ -19,60 +28,98 @@ struct PostgresBinaryCopyGlobalState : public GlobalFunctionData {
 		copy_state.Initialize(context);
 	}
 
-	void Flush(PostgresBinaryWriter &writer) {
-		file_writer->WriteData(writer.stream.GetData(), writer.stream.GetPosition());
+	//! Writes the encoded data to the file - this can be called from multiple threads
+	void WriteData(MemoryStream &stream) {
+		lock_guard<mutex> guard(lock);
+		file_writer->WriteData(stream.GetData(), stream.GetPosition());
+		bytes_written += stream.GetPosition();
+		stream.Rewind();
 	}
 
 	void WriteHeader() {
 		PostgresBinaryWriter writer(copy_state);
 		writer.WriteHeader();
-		Flush(writer);
-	}
-
-	void WriteChunk(DataChunk &chunk) {
-		chunk.Flatten();
-		PostgresBinaryWriter writer(copy_state);
-		for (idx_t r = 0; r < chunk.size(); r++) {
-			writer.BeginRow(chunk.ColumnCount());
-			for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
-				auto &col = chunk.data[c];
-				writer.WriteValue(col, r);
-			}
-			writer.FinishRow();
-		}
-		Flush(writer);
+		WriteData(writer.stream);
 	}
 
 	void Flush() {
 		// write the footer
 		PostgresBinaryWriter writer(copy_state);
 		writer.WriteFooter();
-		Flush(writer);
+		WriteData(writer.stream);
 		// flush and close the file
-		file_writer->Flush();
+		file_writer->Close();
 		file_writer.reset();
 	}
 
 public:
+	mutex lock;
 	unique_ptr<BufferedFileWriter> file_writer;
+	//! Used to write the header and footer
+	PostgresCopyState copy_state;
+	//! The amount of (uncompressed) bytes written to the file
+	atomic<idx_t> bytes_written {0};
+};
+
+struct PostgresBinaryCopyLocalState : public LocalFunctionData {
+	explicit PostgresBinaryCopyLocalState(ClientContext &context) {
+		copy_state.Initialize(context);
+	}
+
+	//! The rows encoded by this thread that have not been written to the file yet
 	PostgresCopyState copy_state;
 };
 
-struct PostgresBinaryWriteBindData : public TableFunctionData {};
+struct PostgresBinaryBatchData : public PreparedBatchData {
+	explicit PostgresBinaryBatchData(ClientContext &context) {
+		copy_state.Initialize(context);
+	}
+
+	//! The encoded rows of the batch
+	PostgresCopyState copy_state;
+};
+
+struct PostgresBinaryWriteBindData : public TableFunctionData {
+	FileCompressionType compression = FileCompressionType::AUTO_DETECT;
+};
 
 unique_ptr<FunctionData> PostgresBinaryCopyFunction::PostgresBinaryWriteBind(ClientContext &context,
                                                                              CopyFunctionBindInput &input,
                                                                              const vector<string> &names,
                                                                              const vector<LogicalType> &sql_types) {
-	return make_uniq<PostgresBinaryWriteBindData>();
+	auto result = make_uniq<PostgresBinaryWriteBindData>();
+	for (auto &option : input.info.options) {
+		auto loption = StringUtil::Lower(option.first);
+		if (loption == "compression") {
+			if (option.second.size() != 1) {
+				throw BinderException("COMPRESSION requires a single argument");
+			}
+			result->compression = FileCompressionTypeFromString(option.second[0].ToString());
+		} else {
+			throw BinderException("Unrecognized option for postgres_binary: %s", option.first);
+		}
+	}
+	return std::move(result);
 }
 
 unique_ptr<GlobalFunctionData>
-PostgresBinaryCopyFunction::PostgresBinaryWriteInitializeGlobal(ClientContext &context, FunctionData &bind_data,
+PostgresBinaryCopyFunction::PostgresBinaryWriteInitializeGlobal(ClientContext &context, FunctionData &bind_data_p,
                                                                 const string &file_path) {
+	auto &bind_data = bind_data_p.Cast<PostgresBinaryWriteBindData>();
+	auto compression = bind_data.compression;
+	if (compression == FileCompressionType::AUTO_DETECT) {
+		if (StringUtil::EndsWith(file_path, ".gz")) {
+			compression = FileCompressionType::GZIP;
+		} else if (StringUtil::EndsWith(file_path, ".zst")) {
+			compression = FileCompressionType::ZSTD;
+		} else {
+			compression = FileCompressionType::UNCOMPRESSED;
+		}
+	}
 	auto result = make_uniq<PostgresBinaryCopyGlobalState>(context);
 	auto &fs = FileSystem::GetFileSystem(context);
-	result->file_writer = make_uniq<BufferedFileWriter>(fs, file_path);
+	result->file_writer =
+	    make_uniq<BufferedFileWriter>(fs, file_path, BufferedFileWriter::DEFAULT_OPEN_FLAGS | compression);
 	// write the header
 	result->WriteHeader();
 	return std::move(result);
@@ -80,18 +127,30 @@ PostgresBinaryCopyFunction::PostgresBinaryWriteInitializeGlobal(ClientContext &c
 
 unique_ptr<LocalFunctionData>
 PostgresBinaryCopyFunction::PostgresBinaryWriteInitializeLocal(ExecutionContext &context, FunctionData &bind_data_p) {
-	return make_uniq<LocalFunctionData>();
+	return make_uniq<PostgresBinaryCopyLocalState>(context.client);
 }
 
 void PostgresBinaryCopyFunction::PostgresBinaryWriteSink(ExecutionContext &context, FunctionData &bind_data_p,
-                                                         GlobalFunctionData &gstate_p, LocalFunctionData &lstate,
+                                                         GlobalFunctionData &gstate_p, LocalFunctionData &lstate_p,
                                                          DataChunk &input) {
 	auto &gstate = gstate_p.Cast<PostgresBinaryCopyGlobalState>();
-	gstate.WriteChunk(input);
+	auto &lstate = lstate_p.Cast<PostgresBinaryCopyLocalState>();
+	// encode the chunk in the thread-local buffer - the file is only locked once the buffer is full
+	input.Flatten();
+	PostgresBinaryWriter writer(lstate.copy_state);
+	writer.WriteChunk(input);
+	if (writer.stream.GetPosition() >= FLUSH_SIZE) {
+		gstate.WriteData(writer.stream);
+	}
 }
 
 void PostgresBinaryCopyFunction::PostgresBinaryWriteCombine(ExecutionContext &context, FunctionData &bind_data,
-                                                            GlobalFunctionData &gstate, LocalFunctionData &lstate) {
+                                                            GlobalFunctionData &gstate_p, LocalFunctionData &lstate_p) {
+	auto &gstate = gstate_p.Cast<PostgresBinaryCopyGlobalState>();
+	auto &lstate = lstate_p.Cast<PostgresBinaryCopyLocalState>();
+	if (lstate.copy_state.buffer.GetPosition() > 0) {
+		gstate.WriteData(lstate.copy_state.buffer);
+	}
 }
 
 void PostgresBinaryCopyFunction::PostgresBinaryWriteFinalize(ClientContext &context, FunctionData &bind_data,
@@ -101,4 +160,42 @@ void PostgresBinaryCopyFunction::PostgresBinaryWriteFinalize(ClientContext &cont
 	gstate.Flush();
 }
 
+CopyFunctionExecutionMode PostgresBinaryCopyFunction::PostgresBinaryWriteExecutionMode(bool preserve_insertion_order,
+                                                                                       bool supports_batch_index) {
+	if (!preserve_insertion_order) {
+		// rows are written in the order in which threads flush their buffers
+		return CopyFunctionExecutionMode::PARALLEL_COPY_TO_FILE;
+	}
+	if (supports_batch_index) {
+		// batches are encoded in parallel and written in order of their batch index
+		return CopyFunctionExecutionMode::BATCH_COPY_TO_FILE;
+	}
+	return CopyFunctionExecutionMode::REGULAR_COPY_TO_FILE;
+}
+
+unique_ptr<PreparedBatchData> PostgresBinaryCopyFunction::PostgresBinaryWritePrepareBatch(
+    ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
+    unique_ptr<ColumnDataCollection> collection) {
+	auto result = make_uniq<PostgresBinaryBatchData>(context);
+	PostgresBinaryWriter writer(result->copy_state);
+	for (auto &chunk : collection->Chunks()) {
+		chunk.Flatten();
+		writer.WriteChunk(chunk);
+	}
+	return std::move(result);
+}
+
+void PostgresBinaryCopyFunction::PostgresBinaryWriteFlushBatch(ClientContext &context, FunctionData &bind_data,
+                                                               GlobalFunctionData &gstate_p,
+                                                               PreparedBatchData &batch_p) {
+	auto &gstate = gstate_p.Cast<PostgresBinaryCopyGlobalState>();
+	auto &batch = batch_p.Cast<PostgresBinaryBatchData>();
+	gstate.WriteData(batch.copy_state.buffer);
+}
+
+idx_t PostgresBinaryCopyFunction::PostgresBinaryWriteFileSize(GlobalFunctionData &gstate_p) {
+	auto &gstate = gstate_p.Cast<PostgresBinaryCopyGlobalState>();
+	return gstate.bytes_written;
+}
+
 } // namespace duckdb
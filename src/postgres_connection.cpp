@@ -2,6 +2,7 @@
 #include "duckdb/parser/column_list.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "postgres_connection.hpp"
+#include "postgres_conversion.hpp"
 #include "duckdb/common/types/uuid.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 #include "duckdb/common/helper.hpp"
@@ -47,6 +48,16 @@ PostgresConnection PostgresConnection::Open(const string &connection_string) {
 	return result;
 }
 
+vector<PostgresConnection> PostgresConnection::OpenParallel(const string &connection_string, idx_t count) {
+	vector<PostgresConnection> result;
+	for (auto conn : PostgresUtils::PGConnectParallel(connection_string, count)) {
+		PostgresConnection connection(make_shared_ptr<OwnedPostgresConnection>(conn));
+		connection.dsn = connection_string;
+		result.push_back(std::move(connection));
+	}
+	return result;
+}
+
 static bool ResultHasError(PGresult *result) {
 	if (!result) {
 		return true;
@@ -121,6 +132,120 @@ vector<unique_ptr<PostgresResult>> PostgresConnection::ExecuteQueries(const stri
 	return results;
 }
 
+//! Leaves pipeline mode after a failure - pending results are drained up to the pipeline sync first, as libpq
+//! refuses to leave pipeline mode while results are outstanding
+static void PGAbortPipeline(PGconn *conn, bool sync_sent) {
+	if (!sync_sent && PQpipelineSync(conn) != 1) {
+		PQexitPipelineMode(conn);
+		return;
+	}
+	// every statement is terminated by a nullptr - two in a row means there are no results left
+	bool previous_was_null = false;
+	while (PQstatus(conn) == CONNECTION_OK) {
+		auto res = PQgetResult(conn);
+		if (!res) {
+			if (previous_was_null) {
+				break;
+			}
+			previous_was_null = true;
+			continue;
+		}
+		previous_was_null = false;
+		auto status = PQresultStatus(res);
+		PQclear(res);
+		if (status == PGRES_PIPELINE_SYNC) {
+			break;
+		}
+	}
+	PQexitPipelineMode(conn);
+}
+
+idx_t PostgresConnection::ExecutePipelined(const string &query, const_data_ptr_t tuples, idx_t size) {
+	if (PostgresConnection::DebugPrintQueries()) {
+		Printer::Print(query + "\n");
+	}
+	lock_guard<mutex> guard(connection->connection_lock);
+	auto conn = GetConn();
+	if (PQenterPipelineMode(conn) != 1) {
+		throw IOException("Failed to enter pipeline mode: %s", PQerrorMessage(conn));
+	}
+	idx_t affected_rows = 0;
+	string error;
+	bool sync_sent = false;
+	try {
+		// send the statements - the first statement prepares the query
+		idx_t statement_count = 0;
+		vector<const char *> values;
+		vector<int> lengths;
+		vector<int> formats;
+		idx_t offset = 0;
+		while (offset < size) {
+			auto field_count = ntohs(Load<uint16_t>(tuples + offset));
+			offset += sizeof(uint16_t);
+			values.resize(field_count);
+			lengths.resize(field_count);
+			formats.resize(field_count, 1);
+			for (idx_t f = 0; f < field_count; f++) {
+				auto length = int32_t(ntohl(Load<uint32_t>(tuples + offset)));
+				offset += sizeof(uint32_t);
+				if (length < 0) {
+					// NULL value
+					values[f] = nullptr;
+					lengths[f] = 0;
+					continue;
+				}
+				values[f] = const_char_ptr_cast(tuples + offset);
+				lengths[f] = length;
+				offset += NumericCast<idx_t>(length);
+			}
+			if (statement_count == 0 && PQsendPrepare(conn, "", query.c_str(), int(field_count), nullptr) != 1) {
+				throw IOException("Failed to prepare query \"%s\": %s", query, PQerrorMessage(conn));
+			}
+			if (PQsendQueryPrepared(conn, "", int(field_count), values.data(), lengths.data(), formats.data(), 0) !=
+			    1) {
+				throw IOException("Failed to send query \"%s\": %s", query, PQerrorMessage(conn));
+			}
+			statement_count++;
+		}
+		if (PQpipelineSync(conn) != 1) {
+			throw IOException("Failed to send pipeline sync: %s", PQerrorMessage(conn));
+		}
+		sync_sent = true;
+		// read the results - every statement (including the prepare) returns a result followed by a nullptr
+		// once a statement fails, the remaining statements are aborted
+		for (idx_t i = 0; i < statement_count + 1; i++) {
+			while (true) {
+				auto res = PQgetResult(conn);
+				if (!res) {
+					break;
+				}
+				PostgresResult result(res);
+				auto status = PQresultStatus(res);
+				if (status == PGRES_COMMAND_OK) {
+					if (i > 0) {
+						affected_rows += result.AffectedRows();
+					}
+				} else if (status != PGRES_PIPELINE_ABORTED && error.empty()) {
+					error = PQresultErrorMessage(res);
+				}
+			}
+		}
+		PostgresResult sync_result(PQgetResult(conn));
+		if (!sync_result.res || PQresultStatus(sync_result.res) != PGRES_PIPELINE_SYNC) {
+			throw IOException("Failed to execute query \"%s\": expected a pipeline sync", query);
+		}
+	} catch (...) {
+		// the connection is shared with the transaction - it must not be left in pipeline mode
+		PGAbortPipeline(conn, sync_sent);
+		throw;
+	}
+	PQexitPipelineMode(conn);
+	if (!error.empty()) {
+		throw std::runtime_error("Failed to execute query \"" + query + "\": " + error);
+	}
+	return affected_rows;
+}
+
 PostgresVersion PostgresConnection::GetPostgresVersion() {
 	auto result = TryQuery("SELECT version(), (SELECT COUNT(*) FROM pg_settings WHERE name LIKE 'rds%')");
 	if (!result) {
@@ -146,6 +271,37 @@ void PostgresConnection::Close() {
 	connection = nullptr;
 }
 
+bool PostgresConnection::Ping() {
+	lock_guard<mutex> guard(connection->connection_lock);
+	auto conn = GetConn();
+	if (PQstatus(conn) != CONNECTION_OK || PQtransactionStatus(conn) != PQTRANS_IDLE) {
+		return false;
+	}
+	// an empty query string is the cheapest statement that still requires a server round-trip
+	auto result = PQexec(conn, "");
+	bool alive = result && PQresultStatus(result) == PGRES_EMPTY_QUERY;
+	PQclear(result);
+	return alive && PQstatus(conn) == CONNECTION_OK;
+}
+
+bool PostgresConnection::Reset() {
+	lock_guard<mutex> guard(connection->connection_lock);
+	auto conn = GetConn();
+	PQreset(conn);
+	return PQstatus(conn) == CONNECTION_OK;
+}
+
+void PostgresConnection::Cancel() {
+	auto cancel = PQgetCancel(GetConn());
+	if (!cancel) {
+		return;
+	}
+	// the cancel request is sent over a separate connection - a failure just means the query keeps running
+	char error_buffer[256];
+	PQcancel(cancel, error_buffer, sizeof(error_buffer));
+	PQfreeCancel(cancel);
+}
+
 vector<IndexInfo> PostgresConnection::GetIndexInfo(const string &table_name) {
 	return vector<IndexInfo>();
 }
@@ -0,0 +1,365 @@
+#include "duckdb.hpp"
+
+#include "duckdb/main/appender.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/parser/parsed_data/create_schema_info.hpp"
+#include "duckdb/parser/parsed_data/create_table_info.hpp"
+#include "postgres_scanner.hpp"
+#include "postgres_binary_reader.hpp"
+#include "postgres_text_reader.hpp"
+#include "storage/postgres_catalog.hpp"
+#include "storage/postgres_schema_entry.hpp"
+#include "storage/postgres_table_entry.hpp"
+#include "storage/postgres_transaction.hpp"
+
+namespace duckdb {
+
+struct PostgresCopyDatabaseBindData : public TableFunctionData {
+	PostgresCopyDatabaseBindData(PostgresCatalog &source, string target_p)
+	    : source(source), target(std::move(target_p)) {
+	}
+
+	PostgresCatalog &source;
+	string target;
+	//! The tables (and views) that are copied
+	vector<reference<PostgresTableEntry>> tables;
+};
+
+//! A table that is being copied - the rows read by all tasks of the table are appended through a single appender
+struct PostgresCopyDatabaseTable {
+	explicit PostgresCopyDatabaseTable(PostgresTableEntry &entry) : entry(entry) {
+	}
+
+	PostgresTableEntry &entry;
+	unique_ptr<FunctionData> bind_data;
+	vector<column_t> column_ids;
+	mutex append_lock;
+	unique_ptr<Appender> appender;
+	idx_t row_count = 0;
+	//! The number of tasks of this table that have not finished yet - the appender is closed after the last one
+	idx_t remaining_tasks = 0;
+
+	const PostgresBindData &GetBindData() const {
+		return bind_data->Cast<PostgresBindData>();
+	}
+};
+
+//! A range of pages of a single table
+struct PostgresCopyDatabaseTask {
+	idx_t table_idx;
+	idx_t page_min;
+	idx_t page_max;
+	//! The (approximate) amount of pages read by the task - used to schedule large tasks first
+	idx_t page_count;
+};
+
+struct PostgresCopyDatabaseGlobalState : public GlobalTableFunctionState {
+	~PostgresCopyDatabaseGlobalState() override {
+		// close the appenders before the connection - if we did not commit the copy is rolled back
+		tables.clear();
+		connection.reset();
+	}
+
+	mutable mutex lock;
+	//! The connection over which the target tables are created and filled - all appends happen in one transaction
+	unique_ptr<Connection> connection;
+	vector<unique_ptr<PostgresCopyDatabaseTable>> tables;
+	vector<PostgresCopyDatabaseTask> tasks;
+	idx_t next_task = 0;
+	idx_t finished_tasks = 0;
+	//! The connection of the Postgres transaction - its snapshot is shared by all readers
+	PostgresConnection source_connection;
+	string snapshot;
+	bool used_source_connection = false;
+	idx_t max_threads = 1;
+	//! Whether or not all data was copied and committed
+	bool finished = false;
+	idx_t result_offset = 0;
+
+	idx_t MaxThreads() const override {
+		return max_threads;
+	}
+
+	void FinishTask(const PostgresCopyDatabaseTask &task);
+	void Commit();
+};
+
+struct PostgresCopyDatabaseLocalState : public LocalTableFunctionState {
+	~PostgresCopyDatabaseLocalState() override {
+		PostgresScanFunction::EndScanTransaction(pool_connection);
+	}
+
+	PostgresConnection connection;
+	PostgresPoolConnection pool_connection;
+	bool can_cancel = false;
+	bool no_connection = false;
+
+	void CopyTask(ClientContext &context, PostgresCopyDatabaseTable &table, const PostgresCopyDatabaseTask &task);
+};
+
+static unique_ptr<FunctionData> PostgresCopyDatabaseBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	auto source_name = input.inputs[0].GetValue<string>();
+	auto target_name = input.inputs[1].GetValue<string>();
+	auto &db_manager = DatabaseManager::Get(context);
+	auto source_db = db_manager.GetDatabase(context, source_name);
+	if (!source_db) {
+		throw BinderException("Failed to find attached database \"%s\" referenced in postgres_copy_database",
+		                      source_name);
+	}
+	auto &source_catalog = source_db->GetCatalog();
+	if (source_catalog.GetCatalogType() != "postgres") {
+		throw BinderException("Attached database \"%s\" does not refer to a Postgres database", source_name);
+	}
+	auto target_db = db_manager.GetDatabase(context, target_name);
+	if (!target_db) {
+		throw BinderException("Failed to find attached database \"%s\" referenced in postgres_copy_database",
+		                      target_name);
+	}
+	if (target_db->GetCatalog().GetCatalogType() == "postgres") {
+		throw BinderException("postgres_copy_database cannot copy into a Postgres database - use COPY FROM "
+		                      "DATABASE instead");
+	}
+	auto &pg_catalog = source_catalog.Cast<PostgresCatalog>();
+	auto result = make_uniq<PostgresCopyDatabaseBindData>(pg_catalog, target_name);
+	pg_catalog.ScanSchemas(context, [&](SchemaCatalogEntry &schema) {
+		if (schema.internal) {
+			return;
+		}
+		schema.Scan(context, CatalogType::TABLE_ENTRY,
+		            [&](CatalogEntry &entry) { result->tables.push_back(entry.Cast<PostgresTableEntry>()); });
+	});
+
+	names.emplace_back("schema_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("table_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("row_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+	return std::move(result);
+}
+
+static void CreateTargetTables(const PostgresCopyDatabaseBindData &bind_data, PostgresCopyDatabaseGlobalState &gstate) {
+	auto &target_context = *gstate.connection->context;
+	target_context.RunFunctionInTransaction([&]() {
+		auto &catalog = Catalog::GetCatalog(target_context, bind_data.target);
+		for (auto &table_p : gstate.tables) {
+			auto &entry = table_p->entry;
+			CreateSchemaInfo schema_info;
+			schema_info.catalog = bind_data.target;
+			schema_info.schema = entry.schema.name;
+			schema_info.on_conflict = OnCreateConflict::IGNORE_ON_CONFLICT;
+			catalog.CreateSchema(target_context, schema_info);
+
+			// only the columns are copied - defaults and constraints refer to objects that only exist in Postgres
+			auto info = make_uniq<CreateTableInfo>(bind_data.target, entry.schema.name, entry.name);
+			for (auto &col : entry.GetColumns().Logical()) {
+				info->columns.AddColumn(ColumnDefinition(col.GetName(), col.GetType()));
+			}
+			catalog.CreateTable(target_context, std::move(info));
+		}
+	});
+	for (auto &table : gstate.tables) {
+		table->appender =
+		    make_uniq<Appender>(*gstate.connection, bind_data.target, table->entry.schema.name, table->entry.name);
+	}
+}
+
+static void CreateTasks(PostgresCopyDatabaseGlobalState &gstate) {
+	for (idx_t table_idx = 0; table_idx < gstate.tables.size(); table_idx++) {
+		auto &table = *gstate.tables[table_idx];
+		auto &bind_data = table.GetBindData();
+		if (bind_data.pages_approx == 0) {
+			// no ctid scan - read the table in one go
+			gstate.tasks.push_back({table_idx, 0, POSTGRES_TID_MAX, table.entry.approx_num_pages});
+			table.remaining_tasks++;
+			continue;
+		}
+		for (idx_t page_idx = 0; page_idx < bind_data.pages_approx; page_idx += bind_data.pages_per_task) {
+			auto page_max = page_idx + bind_data.pages_per_task;
+			auto page_count = bind_data.pages_per_task;
+			if (page_max >= bind_data.pages_approx || page_max > POSTGRES_TID_MAX) {
+				// the relpages entry is not the real max, so make the last task bigger
+				page_count = bind_data.pages_approx - page_idx;
+				page_max = POSTGRES_TID_MAX;
+			}
+			gstate.tasks.push_back({table_idx, page_idx, page_max, page_count});
+			table.remaining_tasks++;
+		}
+	}
+	// schedule the largest tasks first so that the tasks of small tables fill up the threads at the end of the copy
+	std::stable_sort(gstate.tasks.begin(), gstate.tasks.end(),
+	                 [](const PostgresCopyDatabaseTask &a, const PostgresCopyDatabaseTask &b) {
+		                 return a.page_count > b.page_count;
+	                 });
+}
+
+static unique_ptr<GlobalTableFunctionState> PostgresCopyDatabaseInitGlobalState(ClientContext &context,
+                                                                                TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<PostgresCopyDatabaseBindData>();
+	auto &pg_catalog = bind_data.source;
+	auto &transaction = Transaction::Get(context, pg_catalog).Cast<PostgresTransaction>();
+
+	auto result = make_uniq<PostgresCopyDatabaseGlobalState>();
+	for (auto &entry : bind_data.tables) {
+		auto table = make_uniq<PostgresCopyDatabaseTable>(entry.get());
+		entry.get().GetScanFunction(context, table->bind_data);
+		for (idx_t col_idx = 0; col_idx < table->GetBindData().types.size(); col_idx++) {
+			table->column_ids.push_back(col_idx);
+		}
+		result->tables.push_back(std::move(table));
+	}
+	CreateTasks(*result);
+
+	result->connection = make_uniq<Connection>(*context.db);
+	result->connection->BeginTransaction();
+	CreateTargetTables(bind_data, *result);
+
+	result->source_connection = PostgresConnection(transaction.GetConnection().GetConnection());
+	if (transaction.IsReadOnly() && result->tasks.size() > 1) {
+		// all readers share the snapshot of the transaction so that the copy is consistent across tables
+		result->snapshot = PostgresScanFunction::ExportSnapshot(pg_catalog.GetPostgresVersion(),
+		                                                         result->source_connection);
+	}
+	if (!result->snapshot.empty()) {
+		auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		result->max_threads = MinValue<idx_t>(result->tasks.size(), thread_count);
+		// the first reader re-uses the transaction connection
+		pg_catalog.GetConnectionPool().WarmUp(result->max_threads - 1);
+	}
+	if (result->tasks.empty()) {
+		result->Commit();
+	}
+	return std::move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> PostgresCopyDatabaseInitLocalState(ExecutionContext &context,
+                                                                               TableFunctionInitInput &input,
+                                                                               GlobalTableFunctionState *global_state) {
+	auto &bind_data = input.bind_data->Cast<PostgresCopyDatabaseBindData>();
+	auto &gstate = global_state->Cast<PostgresCopyDatabaseGlobalState>();
+	auto result = make_uniq<PostgresCopyDatabaseLocalState>();
+	{
+		lock_guard<mutex> guard(gstate.lock);
+		if (!gstate.used_source_connection) {
+			// the connection belongs to the transaction - cancelling a COPY would abort it
+			result->connection = PostgresConnection(gstate.source_connection.GetConnection());
+			gstate.used_source_connection = true;
+			return std::move(result);
+		}
+	}
+	if (gstate.snapshot.empty() || !bind_data.source.GetConnectionPool().TryGetConnection(result->pool_connection)) {
+		// if the connection pool is exhausted we bail-out
+		result->no_connection = true;
+		return std::move(result);
+	}
+	result->connection = PostgresConnection(result->pool_connection.GetConnection().GetConnection());
+	result->can_cancel = true;
+	PostgresScanFunction::BeginScanTransaction(result->connection, gstate.snapshot);
+	return std::move(result);
+}
+
+void PostgresCopyDatabaseLocalState::CopyTask(ClientContext &context, PostgresCopyDatabaseTable &table,
+                                              const PostgresCopyDatabaseTask &task) {
+	auto &bind_data = table.GetBindData();
+	unique_ptr<PostgresResultReader> reader;
+	if (bind_data.use_text_protocol) {
+		reader = make_uniq<PostgresTextReader>(context, connection, table.column_ids, bind_data);
+	} else {
+		reader = make_uniq<PostgresBinaryReader>(context, connection, table.column_ids, bind_data, can_cancel);
+	}
+	reader->BeginCopy(
+	    PostgresScanFunction::GetScanQuery(bind_data, table.column_ids, nullptr, task.page_min, task.page_max));
+
+	DataChunk chunk;
+	chunk.Initialize(Allocator::Get(context), bind_data.types);
+	while (true) {
+		chunk.Reset();
+		auto read_result = reader->Read(chunk);
+		if (chunk.size() > 0) {
+			lock_guard<mutex> guard(table.append_lock);
+			table.appender->AppendDataChunk(chunk);
+			table.row_count += chunk.size();
+		}
+		if (read_result == PostgresReadResult::FINISHED) {
+			break;
+		}
+	}
+}
+
+void PostgresCopyDatabaseGlobalState::FinishTask(const PostgresCopyDatabaseTask &task) {
+	auto &table = *tables[task.table_idx];
+	bool close_table;
+	{
+		lock_guard<mutex> guard(lock);
+		close_table = --table.remaining_tasks == 0;
+	}
+	if (close_table) {
+		// flush the remaining rows of the table while the other tables are still being read
+		lock_guard<mutex> guard(table.append_lock);
+		table.appender->Close();
+	}
+	lock_guard<mutex> guard(lock);
+	if (++finished_tasks == tasks.size()) {
+		Commit();
+	}
+}
+
+void PostgresCopyDatabaseGlobalState::Commit() {
+	connection->Commit();
+	finished = true;
+}
+
+static void PostgresCopyDatabaseScan(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
+	auto &gstate = data.global_state->Cast<PostgresCopyDatabaseGlobalState>();
+	auto &lstate = data.local_state->Cast<PostgresCopyDatabaseLocalState>();
+	while (!lstate.no_connection) {
+		optional_ptr<PostgresCopyDatabaseTask> task;
+		{
+			lock_guard<mutex> guard(gstate.lock);
+			if (gstate.next_task < gstate.tasks.size()) {
+				task = gstate.tasks[gstate.next_task++];
+			}
+		}
+		if (!task) {
+			break;
+		}
+		lstate.CopyTask(context, *gstate.tables[task->table_idx], *task);
+		gstate.FinishTask(*task);
+	}
+	// the thread that finished the copy reports the copied tables
+	lock_guard<mutex> guard(gstate.lock);
+	if (!gstate.finished) {
+		return;
+	}
+	idx_t count = 0;
+	for (; gstate.result_offset < gstate.tables.size() && count < STANDARD_VECTOR_SIZE; gstate.result_offset++) {
+		auto &table = *gstate.tables[gstate.result_offset];
+		output.SetValue(0, count, Value(table.entry.schema.name));
+		output.SetValue(1, count, Value(table.entry.name));
+		output.SetValue(2, count, Value::BIGINT(NumericCast<int64_t>(table.row_count)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+static double PostgresCopyDatabaseProgress(ClientContext &context, const FunctionData *bind_data_p,
+                                           const GlobalTableFunctionState *global_state) {
+	auto &gstate = global_state->Cast<PostgresCopyDatabaseGlobalState>();
+	lock_guard<mutex> guard(gstate.lock);
+	if (gstate.tasks.empty()) {
+		return 100;
+	}
+	return 100 * double(gstate.finished_tasks) / double(gstate.tasks.size());
+}
+
+PostgresCopyDatabaseFunction::PostgresCopyDatabaseFunction()
+    : TableFunction("postgres_copy_database", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+                    PostgresCopyDatabaseScan, PostgresCopyDatabaseBind, PostgresCopyDatabaseInitGlobalState,
+                    PostgresCopyDatabaseInitLocalState) {
+	table_scan_progress = PostgresCopyDatabaseProgress;
+}
+
+} // namespace duckdb
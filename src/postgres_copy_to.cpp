@@ -61,6 +61,11 @@ void PostgresConnection::BeginCopyTo(ClientContext &context, PostgresCopyState &
 	if (!result || PQresultStatus(result) != PGRES_COPY_IN) {
 		throw std::runtime_error("Failed to prepare COPY \"" + query + "\": " + string(PQresultErrorMessage(result)));
 	}
+	// send data in non-blocking mode so we can encode new data while previous data is being sent
+	state.buffer.Rewind();
+	if (PQsetnonblocking(GetConn(), 1) != 0) {
+		throw IOException("Failed to set Postgres connection to non-blocking mode: %s", PQerrorMessage(GetConn()));
+	}
 	if (state.format == PostgresCopyFormat::BINARY) {
 		// binary copy requires a header
 		PostgresBinaryWriter writer(state);
@@ -71,20 +76,49 @@ void PostgresConnection::BeginCopyTo(ClientContext &context, PostgresCopyState &
 
 void PostgresConnection::CopyData(data_ptr_t buffer, idx_t size) {
 	int result;
-	do {
-		result = PQputCopyData(GetConn(), (const char *)buffer, int(size));
-	} while (result == 0);
+	while ((result = PQputCopyData(GetConn(), (const char *)buffer, int(size))) == 0) {
+		// the data could not be queued (non-blocking mode) - wait until we can send more data
+		PostgresUtils::PGWaitForOutput(GetConn(), -1);
+	}
 	if (result == -1) {
 		throw InternalException("Error during PQputCopyData: %s", PQerrorMessage(GetConn()));
 	}
 }
 
 void PostgresConnection::CopyData(PostgresBinaryWriter &writer) {
-	CopyData(writer.stream.GetData(), writer.stream.GetPosition());
+	FlushCopyData(writer.state);
 }
 
 void PostgresConnection::CopyData(PostgresTextWriter &writer) {
-	CopyData(writer.stream.GetData(), writer.stream.GetPosition());
+	FlushCopyData(writer.state);
+}
+
+void PostgresConnection::FlushOutput() {
+	while (true) {
+		auto result = PQflush(GetConn());
+		if (result == 0) {
+			return;
+		}
+		if (result < 0) {
+			throw IOException("Failed to send COPY data to Postgres: %s", PQerrorMessage(GetConn()));
+		}
+		PostgresUtils::PGWaitForOutput(GetConn(), -1);
+	}
+}
+
+void PostgresConnection::FlushCopyData(PostgresCopyState &state, bool force) {
+	auto &buffer = state.buffer;
+	if (buffer.GetPosition() == 0 || (!force && buffer.GetPosition() < COPY_BUFFER_SIZE)) {
+		return;
+	}
+	// wait until the previous batch has been sent - this bounds the amount of data queued in libpq
+	FlushOutput();
+	CopyData(buffer.GetData(), buffer.GetPosition());
+	buffer.Rewind();
+	// start sending this batch - in non-blocking mode this only sends what fits in the socket buffer
+	if (PQflush(GetConn()) < 0) {
+		throw IOException("Failed to send COPY data to Postgres: %s", PQerrorMessage(GetConn()));
+	}
 }
 
 void PostgresConnection::FinishCopyTo(PostgresCopyState &state) {
@@ -92,13 +126,15 @@ void PostgresConnection::FinishCopyTo(PostgresCopyState &state) {
 		// binary copy requires a footer
 		PostgresBinaryWriter writer(state);
 		writer.WriteFooter();
-		CopyData(writer);
 	} else if (state.format == PostgresCopyFormat::TEXT) {
 		// text copy requires a footer
 		PostgresTextWriter writer(state);
 		writer.WriteFooter();
-		CopyData(writer);
 	}
+	// send all remaining data and switch back to blocking mode
+	FlushCopyData(state, true);
+	FlushOutput();
+	PQsetnonblocking(GetConn(), 0);
 
 	auto result_code = PQputCopyEnd(GetConn(), nullptr);
 	if (result_code != 1) {
@@ -113,56 +149,60 @@ void PostgresConnection::FinishCopyTo(PostgresCopyState &state) {
 	}
 }
 
-bool NeedsQuotes(const string &to_quote, idx_t size) {
-	// Check if the string contains list or struct specific characters, or if it's empty or starts/ends with whitespaces
-	if (size <= 0) {
-		// Always quote the empty string
-		return true;
-	}
-	if (isspace(to_quote[0])) {
-		// The string starts with whitespace, we need to preserve it
-		return true;
-	}
-	if (isspace(to_quote[size - 1])) {
-		// The string ends with whitespace, we need to preserve it
-		return true;
-	}
+//! How an element is written into an array or composite literal
+struct PostgresLiteralElement {
+	//! Whether the element is quoted - quotes and backslashes within quoted elements are escaped
+	bool quote = false;
+	//! The size of the element once written
+	idx_t size = 0;
+};
+
+static PostgresLiteralElement AnalyzeElement(string_t str) {
+	// elements are quoted if they contain list or struct specific characters, or if they are empty or start/end with
+	// whitespace - the quoting decision and the escaped size are computed in a single pass over the string
+	PostgresLiteralElement result;
+	auto data = str.GetData();
+	auto size = str.GetSize();
+	result.quote = size == 0 || StringUtil::CharacterIsSpace(data[0]) || StringUtil::CharacterIsSpace(data[size - 1]);
+	idx_t escape_count = 0;
 	for (idx_t c = 0; c < size; c++) {
-		switch (to_quote[c]) {
+		switch (data[c]) {
 		case '"':
 		case '\\':
+			escape_count++;
+			result.quote = true;
+			break;
 		case '{':
 		case '}':
 		case '(':
 		case ')':
 		case ',':
-			return true;
+			result.quote = true;
+			break;
+		default:
+			break;
 		}
 	}
-	return false;
+	result.size = result.quote ? size + escape_count + 2 : size;
+	return result;
 }
 
-void EscapeQuotes(const string &to_escape, string &result, idx_t size) {
-	// Escape quotes and backslashes so that the string can be quoted
+static void WriteElement(char *&target, string_t str, const PostgresLiteralElement &element) {
+	auto data = str.GetData();
+	auto size = str.GetSize();
+	if (!element.quote) {
+		memcpy(target, data, size);
+		target += size;
+		return;
+	}
+	*target++ = '"';
 	for (idx_t c = 0; c < size; c++) {
-		switch (to_escape[c]) {
-		case '"':
-		case '\\':
-			result += "\\";
+		if (data[c] == '"' || data[c] == '\\') {
+			*target++ = '\\';
 		}
-		result += to_escape[c];
-	}
-}
-
-void QuoteAndEscapeIfNeeded(const string &to_quote, string &result, idx_t size) {
-	// Quote the string iff it contains list or struct specific characters
-	if (!NeedsQuotes(to_quote, size)) {
-		result += to_quote;
-		return;
+		*target++ = data[c];
 	}
-	result += '"';
-	EscapeQuotes(to_quote, result, size);
-	result += '"';
+	*target++ = '"';
 }
 
 void CastToPostgresVarchar(ClientContext &context, Vector &input, Vector &result, idx_t size);
@@ -175,8 +215,21 @@ void CastListToPostgresArray(ClientContext &context, Vector &input, Vector &varc
 	Vector child_varchar(LogicalType::VARCHAR, child_count);
 	CastToPostgresVarchar(context, child_data, child_varchar, child_count);
 
-	// construct the list entries
+	// decide how every element is written
+	static constexpr idx_t NULL_ELEMENT_SIZE = 4;
 	auto child_entries = FlatVector::GetData<string_t>(child_varchar);
+	vector<PostgresLiteralElement> elements(child_count);
+	for (idx_t child_idx = 0; child_idx < child_count; child_idx++) {
+		if (FlatVector::IsNull(child_varchar, child_idx)) {
+			elements[child_idx].size = NULL_ELEMENT_SIZE;
+		} else if (skip_quoting) {
+			elements[child_idx].size = child_entries[child_idx].GetSize();
+		} else {
+			elements[child_idx] = AnalyzeElement(child_entries[child_idx]);
+		}
+	}
+
+	// write the array literals directly into the string heap of the result
 	auto list_entries = FlatVector::GetData<list_entry_t>(input);
 	auto result_entries = FlatVector::GetData<string_t>(varchar_vector);
 	for (idx_t r = 0; r < size; r++) {
@@ -185,26 +238,30 @@ void CastListToPostgresArray(ClientContext &context, Vector &input, Vector &varc
 			continue;
 		}
 		auto list_entry = list_entries[r];
-		string result;
-		result = "{";
+		// braces and separators
+		idx_t literal_size = 2 + (list_entry.length > 0 ? list_entry.length - 1 : 0);
+		for (idx_t list_idx = 0; list_idx < list_entry.length; list_idx++) {
+			literal_size += elements[list_entry.offset + list_idx].size;
+		}
+		auto result = StringVector::EmptyString(varchar_vector, literal_size);
+		auto target = result.GetDataWriteable();
+		*target++ = '{';
 		for (idx_t list_idx = 0; list_idx < list_entry.length; list_idx++) {
 			if (list_idx > 0) {
-				result += ",";
+				*target++ = ',';
 			}
 			auto child_idx = list_entry.offset + list_idx;
 			if (FlatVector::IsNull(child_varchar, child_idx)) {
-				result += "NULL";
+				memcpy(target, "NULL", NULL_ELEMENT_SIZE);
+				target += NULL_ELEMENT_SIZE;
 			} else {
-				auto child = child_entries[child_idx];
-				if (skip_quoting) {
-					result += child.GetString();
-				} else {
-					QuoteAndEscapeIfNeeded(child.GetString(), result, child.GetSize());
-				}
+				WriteElement(target, child_entries[child_idx], elements[child_idx]);
 			}
 		}
-		result += "}";
-		result_entries[r] = StringVector::AddString(varchar_vector, result);
+		*target++ = '}';
+		D_ASSERT(target == result.GetDataWriteable() + literal_size);
+		result.Finalize();
+		result_entries[r] = result;
 	}
 }
 
@@ -218,28 +275,43 @@ void CastStructToPostgres(ClientContext &context, Vector &input, Vector &varchar
 		child_varchar_vectors.push_back(std::move(child_varchar));
 	}
 
-	// construct the struct entries
+	// write the composite literals directly into the string heap of the result
+	auto child_count = child_varchar_vectors.size();
+	vector<PostgresLiteralElement> elements(child_count);
 	auto result_entries = FlatVector::GetData<string_t>(varchar_vector);
 	for (idx_t r = 0; r < size; r++) {
 		if (FlatVector::IsNull(input, r)) {
 			FlatVector::SetNull(varchar_vector, r, true);
 			continue;
 		}
-		string result;
-		result = "(";
-		for (idx_t c = 0; c < child_varchar_vectors.size(); c++) {
+		// parentheses and separators
+		idx_t literal_size = 2 + (child_count > 0 ? child_count - 1 : 0);
+		for (idx_t c = 0; c < child_count; c++) {
+			auto &child_vector = child_varchar_vectors[c];
+			if (FlatVector::IsNull(child_vector, r)) {
+				// composite literals encode NULL by omitting the value
+				elements[c] = PostgresLiteralElement();
+			} else {
+				elements[c] = AnalyzeElement(FlatVector::GetData<string_t>(child_vector)[r]);
+			}
+			literal_size += elements[c].size;
+		}
+		auto result = StringVector::EmptyString(varchar_vector, literal_size);
+		auto target = result.GetDataWriteable();
+		*target++ = '(';
+		for (idx_t c = 0; c < child_count; c++) {
 			if (c > 0) {
-				result += ",";
+				*target++ = ',';
 			}
-			if (FlatVector::IsNull(child_varchar_vectors[c], r)) {
-				result += ""; // Struct literals encode null by omitting the value
-			} else {
-				auto child = FlatVector::GetData<string_t>(child_varchar_vectors[c])[r];
-				QuoteAndEscapeIfNeeded(child.GetString(), result, child.GetSize());
+			auto &child_vector = child_varchar_vectors[c];
+			if (!FlatVector::IsNull(child_vector, r)) {
+				WriteElement(target, FlatVector::GetData<string_t>(child_vector)[r], elements[c]);
 			}
 		}
-		result += ")";
-		result_entries[r] = StringVector::AddString(varchar_vector, result);
+		*target++ = ')';
+		D_ASSERT(target == result.GetDataWriteable() + literal_size);
+		result.Finalize();
+		result_entries[r] = result;
 	}
 }
 
@@ -295,14 +367,7 @@ void PostgresConnection::CopyChunk(ClientContext &context, PostgresCopyState &st
 
 	if (state.format == PostgresCopyFormat::BINARY) {
 		PostgresBinaryWriter writer(state);
-		for (idx_t r = 0; r < chunk.size(); r++) {
-			writer.BeginRow(chunk.ColumnCount());
-			for (idx_t c = 0; c < chunk.ColumnCount(); c++) {
-				auto &col = chunk.data[c];
-				writer.WriteValue(col, r);
-			}
-			writer.FinishRow();
-		}
+		writer.WriteChunk(chunk);
 		CopyData(writer);
 	} else if (state.format == PostgresCopyFormat::TEXT) {
 		// cast columns to varchar
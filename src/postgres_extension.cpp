@@ -56,6 +56,7 @@ static void SetPostgresConnectionLimit(ClientContext &context, SetScope scope, V
 	if (scope == SetScope::LOCAL) {
 		throw InvalidInputException("pg_connection_limit can only be set globally");
 	}
+	// an explicit change applies to the pools of all attached databases - including pools they share with others
 	auto databases = DatabaseManager::Get(context).GetDatabases(context);
 	for (auto &db_ref : databases) {
 		auto &db = db_ref.get();
@@ -138,15 +139,37 @@ static void LoadInternal(ExtensionLoader &loader) {
 	PostgresClearCacheFunction clear_cache_func;
 	loader.RegisterFunction(clear_cache_func);
 
+	PostgresPoolStatsFunction pool_stats_func;
+	loader.RegisterFunction(pool_stats_func);
+
 	PostgresQueryFunction query_func;
 	loader.RegisterFunction(query_func);
 
 	PostgresExecuteFunction execute_func;
 	loader.RegisterFunction(execute_func);
 
+	PostgresScanChangesFunction scan_changes_func;
+	loader.RegisterFunction(scan_changes_func);
+
+	PostgresChangeWatermarkFunction change_watermark_func;
+	loader.RegisterFunction(change_watermark_func);
+
+	PostgresCopyDatabaseFunction copy_database_func;
+	loader.RegisterFunction(copy_database_func);
+
+	PostgresReplicateFunction replicate_func;
+	loader.RegisterFunction(replicate_func);
+
 	PostgresBinaryCopyFunction binary_copy;
 	loader.RegisterFunction(binary_copy);
 
+	PostgresReadBinaryFunction read_binary;
+	TableFunctionSet read_binary_set(read_binary.name);
+	read_binary_set.AddFunction(read_binary);
+	read_binary.arguments = {LogicalType::LIST(LogicalType::VARCHAR)};
+	read_binary_set.AddFunction(read_binary);
+	loader.RegisterFunction(read_binary_set);
+
 	// Register the new type
 	SecretType secret_type;
 	secret_type.name = "postgres";
@@ -176,8 +199,48 @@ static void LoadInternal(ExtensionLoader &loader) {
 	    LogicalType::BOOLEAN, Value::BOOLEAN(false), PostgresClearCacheFunction::ClearCacheOnSetting);
 	config.AddExtensionOption("pg_connection_cache", "Whether or not to use the connection cache", LogicalType::BOOLEAN,
 	                          Value::BOOLEAN(true), PostgresConnectionPool::PostgresSetConnectionCache);
+	config.AddExtensionOption("pg_connection_idle_timeout",
+	                          "The amount of seconds after which idle cached connections are closed (0 to disable)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(PostgresConnectionPool::DEFAULT_IDLE_TIMEOUT),
+	                          PostgresConnectionPool::PostgresSetIdleTimeout);
+	config.AddExtensionOption(
+	    "pg_connection_health_check_interval",
+	    "The interval in seconds at which idle cached connections are checked in the background (0 to disable)",
+	    LogicalType::UBIGINT, Value::UBIGINT(PostgresConnectionPool::DEFAULT_HEALTH_CHECK_INTERVAL),
+	    PostgresConnectionPool::PostgresSetHealthCheckInterval);
+	config.AddExtensionOption("pg_connection_keepalive_idle",
+	                          "The amount of idle seconds after which TCP keep-alive probes are sent on new "
+	                          "connections (0 to use the system default)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0),
+	                          PostgresConnectionPool::PostgresSetKeepAliveIdle);
 	config.AddExtensionOption("pg_experimental_filter_pushdown", "Whether or not to use filter pushdown",
 	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("pg_insert_connections",
+	                          "The maximum amount of connections used to insert data in parallel. Data written over "
+	                          "separate connections is committed at the end of the INSERT, independent of the "
+	                          "transaction",
+	                          LogicalType::UBIGINT, Value::UBIGINT(1));
+	config.AddExtensionOption("pg_insert_two_phase_commit",
+	                          "Whether or not to commit parallel inserts using a two-phase commit (requires "
+	                          "max_prepared_transactions to be set in Postgres)",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("pg_dml_pushdown",
+	                          "Whether or not to execute UPDATE, DELETE, INSERT ... SELECT and CREATE TABLE AS "
+	                          "statements that can be fully expressed in Postgres as a single statement in Postgres",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("pg_small_dml_threshold",
+	                          "The amount of rows below which INSERT and UPDATE statements are executed as pipelined "
+	                          "prepared statements instead of through COPY (0 to disable)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(100));
+	config.AddExtensionOption("pg_bulk_load",
+	                          "Whether or not CREATE TABLE AS and INSERT into an empty table load the data into an "
+	                          "UNLOGGED table without indexes, and build the indexes and constraints afterwards",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("pg_bulk_load_set_logged",
+	                          "Whether or not to make the table LOGGED again after a bulk load", LogicalType::BOOLEAN,
+	                          Value::BOOLEAN(true));
+	config.AddExtensionOption("pg_bulk_load_analyze", "Whether or not to ANALYZE the table after a bulk load",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
 	config.AddExtensionOption("pg_null_byte_replacement",
 	                          "When writing NULL bytes to Postgres, replace them with the given character",
 	                          LogicalType::VARCHAR, Value(), SetPostgresNullByteReplacement);
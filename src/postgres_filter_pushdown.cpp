@@ -54,7 +54,7 @@ string TransformBlob(const string &val) {
 	return result;
 }
 
-string TransformLiteral(const Value &val) {
+string PostgresFilterPushdown::TransformLiteral(const Value &val) {
 	switch (val.type().id()) {
 	case LogicalTypeId::BLOB:
 		return TransformBlob(StringValue::Get(val));
@@ -0,0 +1,566 @@
+#include "duckdb.hpp"
+
+#include "postgres_scanner.hpp"
+#include "postgres_binary_file_reader.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/function/copy_function.hpp"
+
+namespace duckdb {
+
+PostgresBinaryFileReader::PostgresBinaryFileReader(ClientContext &context, const string &path_p,
+                                                   const ReadPostgresBinaryTask &task, vector<int32_t> field_lengths_p)
+    : path(path_p), column_count(field_lengths_p.size()), field_lengths(std::move(field_lengths_p)),
+      file_size(task.file_size), position(task.start), range_end(task.end), buffer_offset(task.start),
+      anchor(task.start), field_offsets(column_count) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ | FileCompressionType::AUTO_DETECT);
+	buffer.resize(INITIAL_BUFFER_SIZE);
+	if (task.start == 0) {
+		ReadHeader();
+	} else {
+		handle->Seek(task.start);
+		FindTupleStart();
+	}
+}
+
+bool PostgresBinaryFileReader::Ensure(idx_t offset, idx_t size) {
+	D_ASSERT(offset >= buffer_offset);
+	if (offset + size <= buffer_offset + buffer_size) {
+		return true;
+	}
+	// discard the data before the anchor
+	D_ASSERT(anchor >= buffer_offset && anchor <= offset);
+	auto discard = MinValue<idx_t>(anchor - buffer_offset, buffer_size);
+	if (discard > 0) {
+		memmove(buffer.data(), buffer.data() + discard, buffer_size - discard);
+		buffer_offset += discard;
+		buffer_size -= discard;
+	}
+	auto required = offset + size - buffer_offset;
+	if (required > buffer.size()) {
+		buffer.resize(NextPowerOfTwo(required));
+	}
+	while (buffer_size < required) {
+		if (end_of_file) {
+			return false;
+		}
+		auto bytes_read = handle->Read(buffer.data() + buffer_size, buffer.size() - buffer_size);
+		if (bytes_read <= 0) {
+			end_of_file = true;
+			return false;
+		}
+		buffer_size += NumericCast<idx_t>(bytes_read);
+	}
+	return true;
+}
+
+void PostgresBinaryFileReader::ReadHeader() {
+	// signature, flags and header extension length
+	if (!Ensure(0, PostgresConversion::COPY_HEADER_LENGTH + 2 * sizeof(uint32_t)) ||
+	    memcmp(buffer.data(), PostgresConversion::COPY_HEADER, PostgresConversion::COPY_HEADER_LENGTH) != 0) {
+		throw IOException("File \"%s\" is not a Postgres binary COPY file", path);
+	}
+	auto flags = ReadAt<uint32_t>(PostgresConversion::COPY_HEADER_LENGTH);
+	if (flags & (1U << 16U)) {
+		throw NotImplementedException("File \"%s\" contains OIDs - Postgres binary COPY files with OIDs are not "
+		                              "supported",
+		                              path);
+	}
+	auto extension_length = ReadAt<uint32_t>(PostgresConversion::COPY_HEADER_LENGTH + sizeof(uint32_t));
+	position = PostgresConversion::COPY_HEADER_LENGTH + 2 * sizeof(uint32_t) + extension_length;
+	anchor = position;
+	if (!Ensure(position, 0)) {
+		throw IOException("Unexpected end of Postgres binary COPY file \"%s\"", path);
+	}
+}
+
+PostgresBinaryFileReader::TupleResult PostgresBinaryFileReader::ParseTuple(idx_t offset, idx_t &tuple_size) {
+	if (!Ensure(offset, sizeof(int16_t))) {
+		return TupleResult::END_OF_FILE;
+	}
+	auto field_count = ReadAt<int16_t>(offset);
+	if (field_count == -1) {
+		tuple_size = sizeof(int16_t);
+		return TupleResult::TRAILER;
+	}
+	if (field_count < 0 || idx_t(field_count) != column_count) {
+		return TupleResult::INVALID;
+	}
+	auto field_offset = offset + sizeof(int16_t);
+	for (idx_t c = 0; c < column_count; c++) {
+		if (!Ensure(field_offset, sizeof(int32_t))) {
+			return TupleResult::END_OF_FILE;
+		}
+		auto field_length = ReadAt<int32_t>(field_offset);
+		if (field_length < -1 || (field_length >= 0 && field_lengths[c] >= 0 && field_length != field_lengths[c])) {
+			return TupleResult::INVALID;
+		}
+		field_offsets[c] = field_offset;
+		field_offset += sizeof(int32_t) + (field_length > 0 ? idx_t(field_length) : 0);
+		if (file_size != DConstants::INVALID_INDEX && field_offset > file_size) {
+			return TupleResult::INVALID;
+		}
+	}
+	tuple_size = field_offset - offset;
+	if (!Ensure(offset, tuple_size)) {
+		return TupleResult::END_OF_FILE;
+	}
+	return TupleResult::TUPLE;
+}
+
+void PostgresBinaryFileReader::FindTupleStart() {
+	// binary COPY files have no sync markers - we look for a position from which a chain of valid tuples follows
+	// note that the range of the first task always covers the file header
+	auto header_size = PostgresConversion::COPY_HEADER_LENGTH + 2 * sizeof(uint32_t);
+	for (idx_t candidate = MaxValue<idx_t>(position, header_size); candidate < range_end; candidate++) {
+		anchor = candidate;
+		if (!Ensure(candidate, sizeof(int16_t))) {
+			break;
+		}
+		if (ReadAt<int16_t>(candidate) != int16_t(column_count)) {
+			continue;
+		}
+		idx_t offset = candidate;
+		bool valid = false;
+		for (idx_t i = 0; i < VALIDATE_TUPLE_COUNT; i++) {
+			idx_t tuple_size;
+			auto result = ParseTuple(offset, tuple_size);
+			if (result == TupleResult::TRAILER) {
+				// the trailer has to be the last two bytes of the file
+				valid = offset + tuple_size == file_size;
+				break;
+			}
+			if (result != TupleResult::TUPLE) {
+				break;
+			}
+			offset += tuple_size;
+			valid = i + 1 == VALIDATE_TUPLE_COUNT;
+		}
+		if (valid) {
+			position = candidate;
+			return;
+		}
+	}
+	// no tuple starts within this range
+	finished = true;
+}
+
+bool PostgresBinaryFileReader::NextTuple(idx_t &tuple_size) {
+	if (finished) {
+		return false;
+	}
+	if (position >= range_end) {
+		finished = true;
+		return false;
+	}
+	switch (ParseTuple(position, tuple_size)) {
+	case TupleResult::TUPLE:
+		return true;
+	case TupleResult::TRAILER:
+		finished = true;
+		return false;
+	case TupleResult::INVALID:
+		throw IOException("Invalid tuple at offset %llu in Postgres binary COPY file \"%s\" - the tuple does not "
+		                  "match the %llu columns that were specified",
+		                  position, path, column_count);
+	default:
+		throw IOException("Unexpected end of Postgres binary COPY file \"%s\"", path);
+	}
+}
+
+void PostgresBinaryFileReader::Read(DataChunk &output, const vector<column_t> &column_ids,
+                                    const ReadPostgresBinaryBindData &bind_data) {
+	idx_t row = output.size();
+	idx_t tuple_size;
+	while (row < STANDARD_VECTOR_SIZE) {
+		anchor = position;
+		if (!NextTuple(tuple_size)) {
+			break;
+		}
+		auto tuple_end = BufferPointer(position + tuple_size);
+		for (idx_t i = 0; i < column_ids.size(); i++) {
+			auto column_id = column_ids[i];
+			if (column_id >= column_count) {
+				// row id
+				FlatVector::SetNull(output.data[i], row, true);
+				continue;
+			}
+			buffer_ptr = BufferPointer(field_offsets[column_id]);
+			end = tuple_end;
+			ReadValue(bind_data.types[column_id], bind_data.postgres_types[column_id], output.data[i], row);
+		}
+		position += tuple_size;
+		row++;
+	}
+	output.SetCardinality(row);
+}
+
+idx_t PostgresBinaryFileReader::ReadRaw(Vector &output, idx_t row, idx_t max_size) {
+	// keep all tuples of the batch in the buffer so they can be copied at once
+	auto batch_start = position;
+	anchor = batch_start;
+	idx_t tuple_count = 0;
+	idx_t tuple_size;
+	while (position - batch_start < max_size && NextTuple(tuple_size)) {
+		position += tuple_size;
+		tuple_count++;
+	}
+	FlatVector::GetData<string_t>(output)[row] = StringVector::AddStringOrBlob(
+	    output, const_char_ptr_cast(BufferPointer(batch_start)), position - batch_start);
+	return tuple_count;
+}
+
+vector<ReadPostgresBinaryTask> PostgresBinaryFileReader::CreateTasks(ClientContext &context,
+                                                                     const vector<string> &files, idx_t split_size) {
+	vector<ReadPostgresBinaryTask> result;
+	auto &fs = FileSystem::GetFileSystem(context);
+	for (idx_t file_idx = 0; file_idx < files.size(); file_idx++) {
+		ReadPostgresBinaryTask task;
+		task.file_idx = file_idx;
+		task.start = 0;
+		task.end = NumericLimits<idx_t>::Maximum();
+		task.file_size = DConstants::INVALID_INDEX;
+
+		// uncompressed files can be split into ranges that are read in parallel
+		auto handle = fs.OpenFile(files[file_idx], FileFlags::FILE_FLAGS_READ | FileCompressionType::AUTO_DETECT);
+		if (handle->CanSeek()) {
+			auto file_size = handle->GetFileSize();
+			if (file_size > split_size) {
+				task.file_size = file_size;
+				for (idx_t start = 0; start < file_size; start += split_size) {
+					task.start = start;
+					task.end = MinValue<idx_t>(start + split_size, file_size);
+					result.push_back(task);
+				}
+				continue;
+			}
+		}
+		result.push_back(task);
+	}
+	return result;
+}
+
+static bool SupportsBinaryDecoding(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+	case LogicalTypeId::ENUM:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIME_TZ:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::INTERVAL:
+	case LogicalTypeId::UUID:
+		return true;
+	case LogicalTypeId::LIST:
+		return SupportsBinaryDecoding(ListType::GetChildType(type));
+	case LogicalTypeId::STRUCT:
+		for (auto &child : StructType::GetChildTypes(type)) {
+			if (!SupportsBinaryDecoding(child.second)) {
+				return false;
+			}
+		}
+		return true;
+	default:
+		return false;
+	}
+}
+
+static int32_t GetFieldLength(const LogicalType &type, const PostgresType &postgres_type) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		return 1;
+	case LogicalTypeId::SMALLINT:
+		return 2;
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DATE:
+		return 4;
+	case LogicalTypeId::BIGINT:
+		return postgres_type.info == PostgresTypeAnnotation::CTID ? 6 : 8;
+	case LogicalTypeId::DOUBLE:
+		return postgres_type.info == PostgresTypeAnnotation::NUMERIC_AS_DOUBLE ? -1 : 8;
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return 8;
+	case LogicalTypeId::TIME_TZ:
+		return 12;
+	case LogicalTypeId::INTERVAL:
+	case LogicalTypeId::UUID:
+		return 16;
+	default:
+		return -1;
+	}
+}
+
+vector<int32_t> ReadPostgresBinaryBindData::GetFieldLengths() const {
+	vector<int32_t> result;
+	for (idx_t c = 0; c < types.size(); c++) {
+		result.push_back(GetFieldLength(types[c], postgres_types[c]));
+	}
+	return result;
+}
+
+vector<int32_t> ReadPostgresBinaryBindData::GetFieldLengths(const vector<PostgresType> &target_types) const {
+	D_ASSERT(target_types.size() == types.size());
+	vector<int32_t> result;
+	for (idx_t c = 0; c < types.size(); c++) {
+		// annotated columns (e.g. an unconstrained NUMERIC that is read as DOUBLE) are not stored in the binary
+		// format of their DuckDB type
+		auto standard = target_types[c].info == PostgresTypeAnnotation::STANDARD;
+		result.push_back(standard ? GetFieldLength(types[c], target_types[c]) : -1);
+	}
+	return result;
+}
+
+static PostgresType CreatePostgresType(const LogicalType &type) {
+	PostgresType result;
+	switch (type.id()) {
+	case LogicalTypeId::LIST:
+		result.children.push_back(CreatePostgresType(ListType::GetChildType(type)));
+		break;
+	case LogicalTypeId::STRUCT:
+		for (auto &child : StructType::GetChildTypes(type)) {
+			result.children.push_back(CreatePostgresType(child.second));
+		}
+		break;
+	default:
+		break;
+	}
+	return result;
+}
+
+static bool IsKnownPostgresType(const PostgresType &postgres_type) {
+	if (postgres_type.info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
+		return false;
+	}
+	for (auto &child : postgres_type.children) {
+		if (!IsKnownPostgresType(child)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool TryParseTypeModifier(const string &str, int64_t &result) {
+	auto modifier = str;
+	StringUtil::Trim(modifier);
+	if (modifier.empty() || modifier.size() > 4) {
+		return false;
+	}
+	for (auto c : modifier) {
+		if (!StringUtil::CharacterIsDigit(c)) {
+			return false;
+		}
+	}
+	result = std::stoll(modifier);
+	return true;
+}
+
+//! Column types are either Postgres type names (e.g. "int4", "jsonb", "numeric(18,3)" or "text[]"), or DuckDB types
+static LogicalType ParseColumnType(ClientContext &context, const string &type_str, PostgresType &postgres_type) {
+	auto name = StringUtil::Lower(type_str);
+	StringUtil::Trim(name);
+	PostgresTypeData type_data;
+	type_data.type_modifier = -1;
+	while (StringUtil::EndsWith(name, "[]")) {
+		name = name.substr(0, name.size() - 2);
+		StringUtil::Trim(name);
+		type_data.array_dimensions++;
+	}
+	auto modifier_start = name.find('(');
+	if (modifier_start != string::npos && name.back() == ')') {
+		auto modifiers = StringUtil::Split(name.substr(modifier_start + 1, name.size() - modifier_start - 2), ',');
+		name = name.substr(0, modifier_start);
+		StringUtil::Trim(name);
+		// only the precision and scale of numerics affect the decoding
+		int64_t width, scale = 0;
+		if (name == "numeric" && !modifiers.empty() && modifiers.size() <= 2 &&
+		    TryParseTypeModifier(modifiers[0], width) &&
+		    (modifiers.size() == 1 || TryParseTypeModifier(modifiers[1], scale))) {
+			type_data.type_modifier = ((width << 16) | scale) + int64_t(sizeof(int32_t));
+		}
+	}
+	type_data.type_name = (type_data.array_dimensions > 0 ? "_" : "") + name;
+	auto result = PostgresUtils::TypeToLogicalType(nullptr, nullptr, type_data, postgres_type);
+	if (!IsKnownPostgresType(postgres_type)) {
+		// not a Postgres type name - parse it as a DuckDB type
+		result = TransformStringToLogicalType(type_str, context);
+		postgres_type = CreatePostgresType(result);
+	}
+	if (!SupportsBinaryDecoding(result)) {
+		throw BinderException("read_postgres_binary: type \"%s\" (%s) is not supported", type_str,
+		                      result.ToString());
+	}
+	return result;
+}
+
+static void AddFiles(ClientContext &context, const string &pattern, vector<string> &files) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	for (auto &file : fs.GlobFiles(pattern, context, FileGlobOptions::DISALLOW_EMPTY)) {
+		files.push_back(file.path);
+	}
+}
+
+static unique_ptr<FunctionData> ReadPostgresBinaryBind(ClientContext &context, TableFunctionBindInput &input,
+                                                       vector<LogicalType> &return_types, vector<string> &names) {
+	auto result = make_uniq<ReadPostgresBinaryBindData>();
+
+	auto &file_input = input.inputs[0];
+	if (file_input.IsNull()) {
+		throw BinderException("read_postgres_binary: the file name cannot be NULL");
+	}
+	vector<string> patterns;
+	if (file_input.type().id() == LogicalTypeId::LIST) {
+		for (auto &child : ListValue::GetChildren(file_input)) {
+			if (child.IsNull()) {
+				throw BinderException("read_postgres_binary: the file name cannot be NULL");
+			}
+			patterns.push_back(StringValue::Get(child));
+		}
+	} else {
+		patterns.push_back(StringValue::Get(file_input));
+	}
+	for (auto &pattern : patterns) {
+		AddFiles(context, pattern, result->files);
+	}
+
+	for (auto &kv : input.named_parameters) {
+		auto loption = StringUtil::Lower(kv.first);
+		if (loption == "columns") {
+			auto &columns = kv.second;
+			if (columns.IsNull() || columns.type().id() != LogicalTypeId::STRUCT) {
+				throw BinderException("read_postgres_binary: \"columns\" must be a struct of column names and types, "
+				                      "e.g. {'id': 'int4', 'name': 'text'}");
+			}
+			auto &child_types = StructType::GetChildTypes(columns.type());
+			auto &child_values = StructValue::GetChildren(columns);
+			for (idx_t c = 0; c < child_types.size(); c++) {
+				auto &type_value = child_values[c];
+				if (type_value.IsNull() || type_value.type().id() != LogicalTypeId::VARCHAR) {
+					throw BinderException("read_postgres_binary: the type of column \"%s\" must be a string",
+					                      child_types[c].first);
+				}
+				PostgresType postgres_type;
+				auto type = ParseColumnType(context, StringValue::Get(type_value), postgres_type);
+				names.push_back(child_types[c].first);
+				result->types.push_back(std::move(type));
+				result->postgres_types.push_back(std::move(postgres_type));
+			}
+		} else if (loption == "split_size") {
+			result->split_size = UBigIntValue::Get(kv.second);
+			if (result->split_size == 0) {
+				throw BinderException("read_postgres_binary: \"split_size\" must be larger than 0");
+			}
+		}
+	}
+	if (names.empty()) {
+		throw BinderException("read_postgres_binary requires the \"columns\" parameter - binary COPY files do not "
+		                      "contain the names or types of the columns");
+	}
+	return_types = result->types;
+	return std::move(result);
+}
+
+unique_ptr<FunctionData> PostgresReadBinaryFunction::PostgresBinaryCopyFromBind(ClientContext &context,
+                                                                               CopyFromFunctionBindInput &input,
+                                                                               vector<string> &expected_names,
+                                                                               vector<LogicalType> &expected_types) {
+	auto result = make_uniq<ReadPostgresBinaryBindData>();
+	result->copy_from = true;
+	AddFiles(context, input.info.file_path, result->files);
+	for (auto &option : input.info.options) {
+		auto loption = StringUtil::Lower(option.first);
+		if (loption == "split_size") {
+			if (option.second.size() != 1) {
+				throw BinderException("SPLIT_SIZE requires a single argument");
+			}
+			result->split_size = option.second[0].GetValue<uint64_t>();
+			if (result->split_size == 0) {
+				throw BinderException("SPLIT_SIZE must be larger than 0");
+			}
+		} else {
+			throw BinderException("Unrecognized option for postgres_binary: %s", option.first);
+		}
+	}
+	// the files are expected to contain the columns of the table
+	for (auto &type : expected_types) {
+		if (!SupportsBinaryDecoding(type)) {
+			throw BinderException("Type %s is not supported when reading postgres_binary files", type.ToString());
+		}
+		result->types.push_back(type);
+		result->postgres_types.push_back(CreatePostgresType(type));
+	}
+	return std::move(result);
+}
+
+struct ReadPostgresBinaryGlobalState : public GlobalTableFunctionState {
+	vector<ReadPostgresBinaryTask> tasks;
+	atomic<idx_t> next_task {0};
+	vector<column_t> column_ids;
+
+	idx_t MaxThreads() const override {
+		return MaxValue<idx_t>(tasks.size(), 1);
+	}
+};
+
+struct ReadPostgresBinaryLocalState : public LocalTableFunctionState {
+	unique_ptr<PostgresBinaryFileReader> reader;
+};
+
+static unique_ptr<GlobalTableFunctionState> ReadPostgresBinaryInitGlobalState(ClientContext &context,
+                                                                               TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<ReadPostgresBinaryBindData>();
+	auto result = make_uniq<ReadPostgresBinaryGlobalState>();
+	result->column_ids = input.column_ids;
+	result->tasks = PostgresBinaryFileReader::CreateTasks(context, bind_data.files, bind_data.split_size);
+	return std::move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> ReadPostgresBinaryInitLocalState(ExecutionContext &context,
+                                                                             TableFunctionInitInput &input,
+                                                                             GlobalTableFunctionState *global_state) {
+	return make_uniq<ReadPostgresBinaryLocalState>();
+}
+
+static void ReadPostgresBinaryFunction(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
+	auto &bind_data = data.bind_data->Cast<ReadPostgresBinaryBindData>();
+	auto &gstate = data.global_state->Cast<ReadPostgresBinaryGlobalState>();
+	auto &lstate = data.local_state->Cast<ReadPostgresBinaryLocalState>();
+	while (output.size() == 0) {
+		if (!lstate.reader) {
+			auto task_idx = gstate.next_task++;
+			if (task_idx >= gstate.tasks.size()) {
+				return;
+			}
+			auto &task = gstate.tasks[task_idx];
+			lstate.reader = make_uniq<PostgresBinaryFileReader>(context, bind_data.files[task.file_idx], task,
+			                                                    bind_data.GetFieldLengths());
+		}
+		lstate.reader->Read(output, gstate.column_ids, bind_data);
+		if (lstate.reader->Finished()) {
+			lstate.reader.reset();
+		}
+	}
+}
+
+PostgresReadBinaryFunction::PostgresReadBinaryFunction()
+    : TableFunction("read_postgres_binary", {LogicalType::VARCHAR}, ReadPostgresBinaryFunction,
+                    ReadPostgresBinaryBind, ReadPostgresBinaryInitGlobalState, ReadPostgresBinaryInitLocalState) {
+	named_parameters["columns"] = LogicalType::ANY;
+	named_parameters["split_size"] = LogicalType::UBIGINT;
+	projection_pushdown = true;
+}
+
+} // namespace duckdb
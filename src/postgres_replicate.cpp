@@ -0,0 +1,613 @@
+#include "duckdb.hpp"
+
+#include "duckdb/main/appender.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/parser/parsed_data/create_table_info.hpp"
+#include "postgres_scanner.hpp"
+#include "postgres_binary_decoder.hpp"
+#include "postgres_result.hpp"
+#include "storage/postgres_catalog.hpp"
+#include "storage/postgres_table_entry.hpp"
+
+namespace duckdb {
+
+//! Decodes the messages of the pgoutput logical decoding plugin (protocol version 1, binary tuple data)
+struct PgOutputDecoder : public PostgresBinaryDecoder {
+	PgOutputDecoder(data_ptr_t data, idx_t size) {
+		buffer_ptr = data;
+		end = data + size;
+	}
+
+	string ReadCString() {
+		auto str = const_char_ptr_cast(buffer_ptr);
+		auto str_end = static_cast<const char *>(memchr(str, '\0', NumericCast<size_t>(end - buffer_ptr)));
+		if (!str_end) {
+			throw IOException("Postgres scanner - unterminated string in logical replication message");
+		}
+		buffer_ptr += str_end - str + 1;
+		return string(str, NumericCast<idx_t>(str_end - str));
+	}
+};
+
+enum class ReplicatedChangeType : uint8_t { NONE, INSERT, UPDATE, DELETE };
+
+//! A table for which changes are received - changes are staged in a temporary table and applied in batches
+struct ReplicatedRelation {
+	string schema_name;
+	string table_name;
+	char replica_identity;
+	//! For every column of the relation message, the column of the table it belongs to
+	vector<idx_t> column_map;
+	vector<LogicalType> types;
+	vector<PostgresType> postgres_types;
+	vector<string> names;
+	//! The columns that identify a row (the primary key, replica identity index or all columns)
+	vector<idx_t> key_columns;
+
+	//! The staging table: [key columns of the old row] [all columns of the new row] [whether a column is unchanged]
+	string stage_name;
+	unique_ptr<Appender> stage;
+	DataChunk stage_chunk;
+	//! The type of the changes that are currently staged
+	ReplicatedChangeType staged_type = ReplicatedChangeType::NONE;
+	idx_t staged_count = 0;
+	//! The keys touched by the staged changes - a key can only be changed once per batch
+	unordered_set<string> staged_keys;
+
+	idx_t inserted = 0;
+	idx_t updated = 0;
+	idx_t deleted = 0;
+
+	idx_t ColumnCount() const {
+		return types.size();
+	}
+	idx_t KeyCount() const {
+		return key_columns.size();
+	}
+	//! Whether or not rows are identified by a key (and not by all of their values, i.e. REPLICA IDENTITY FULL)
+	bool HasKey() const {
+		return (replica_identity == 'd' || replica_identity == 'i') && !key_columns.empty();
+	}
+};
+
+struct PostgresReplicateBindData : public TableFunctionData {
+	PostgresReplicateBindData(PostgresCatalog &source, string target_p) : source(source), target(std::move(target_p)) {
+	}
+
+	PostgresCatalog &source;
+	string target;
+	string slot_name;
+	string publication;
+	//! The (approximate) maximum amount of changes that are applied - whole transactions are always applied
+	idx_t max_changes = 0;
+};
+
+struct PostgresReplicateGlobalState : public GlobalTableFunctionState {
+	~PostgresReplicateGlobalState() override {
+		// close the staging appenders before the connection - if we did not commit the changes are rolled back
+		relations.clear();
+		connection.reset();
+	}
+
+	bool finished = false;
+	unique_ptr<Connection> connection;
+	unordered_map<uint32_t, unique_ptr<ReplicatedRelation>> relations;
+	//! The order in which the relations were first seen
+	vector<reference<ReplicatedRelation>> relation_order;
+	idx_t result_offset = 0;
+};
+
+static unique_ptr<FunctionData> PostgresReplicateBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	for (auto &param : input.inputs) {
+		if (param.IsNull()) {
+			throw BinderException("Parameters to postgres_replicate cannot be NULL");
+		}
+	}
+	auto source_name = input.inputs[0].GetValue<string>();
+	auto target_name = input.inputs[1].GetValue<string>();
+	auto &db_manager = DatabaseManager::Get(context);
+	auto source_db = db_manager.GetDatabase(context, source_name);
+	if (!source_db) {
+		throw BinderException("Failed to find attached database \"%s\" referenced in postgres_replicate", source_name);
+	}
+	auto &source_catalog = source_db->GetCatalog();
+	if (source_catalog.GetCatalogType() != "postgres") {
+		throw BinderException("Attached database \"%s\" does not refer to a Postgres database", source_name);
+	}
+	auto target_db = db_manager.GetDatabase(context, target_name);
+	if (!target_db) {
+		throw BinderException("Failed to find attached database \"%s\" referenced in postgres_replicate", target_name);
+	}
+	if (target_db->GetCatalog().GetCatalogType() == "postgres") {
+		throw BinderException("postgres_replicate cannot replicate into a Postgres database");
+	}
+	auto &pg_catalog = source_catalog.Cast<PostgresCatalog>();
+	if (pg_catalog.GetPostgresVersion() < PostgresVersion(14, 0, 0)) {
+		throw NotImplementedException("postgres_replicate requires Postgres 14 or newer");
+	}
+	auto result = make_uniq<PostgresReplicateBindData>(pg_catalog, target_name);
+	result->slot_name = input.inputs[2].GetValue<string>();
+	result->publication = input.inputs[3].GetValue<string>();
+	for (auto &kv : input.named_parameters) {
+		if (kv.first == "max_changes") {
+			result->max_changes = UBigIntValue::Get(kv.second);
+		}
+	}
+
+	names.emplace_back("schema_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("table_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("inserted");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("updated");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("deleted");
+	return_types.emplace_back(LogicalType::BIGINT);
+	return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> PostgresReplicateInitGlobalState(ClientContext &context,
+                                                                             TableFunctionInitInput &input) {
+	return make_uniq<PostgresReplicateGlobalState>();
+}
+
+static string GetTargetName(const PostgresReplicateBindData &bind_data, const ReplicatedRelation &relation) {
+	return KeywordHelper::WriteQuoted(bind_data.target, '"') + "." +
+	       KeywordHelper::WriteQuoted(relation.schema_name, '"') + "." +
+	       KeywordHelper::WriteQuoted(relation.table_name, '"');
+}
+
+static void ExecuteQuery(Connection &connection, const string &query) {
+	auto result = connection.Query(query);
+	if (result->HasError()) {
+		result->ThrowError();
+	}
+}
+
+//! Applies the staged changes of a relation to the target table
+static void ApplyStagedChanges(const PostgresReplicateBindData &bind_data, PostgresReplicateGlobalState &gstate,
+                               ReplicatedRelation &relation) {
+	if (relation.staged_type == ReplicatedChangeType::NONE) {
+		return;
+	}
+	if (relation.stage_chunk.size() > 0) {
+		relation.stage->AppendDataChunk(relation.stage_chunk);
+		relation.stage_chunk.Reset();
+	}
+	relation.stage->Flush();
+
+	auto &connection = *gstate.connection;
+	auto target = GetTargetName(bind_data, relation);
+	auto stage = StringUtil::Format("%s.%s.%s", TEMP_CATALOG, DEFAULT_SCHEMA,
+	                                KeywordHelper::WriteQuoted(relation.stage_name, '"'));
+	string key_condition;
+	for (idx_t key_idx = 0; key_idx < relation.KeyCount(); key_idx++) {
+		if (!key_condition.empty()) {
+			key_condition += " AND ";
+		}
+		auto &name = relation.names[relation.key_columns[key_idx]];
+		key_condition += StringUtil::Format("t.%s IS NOT DISTINCT FROM s.__key_%d",
+		                                    KeywordHelper::WriteQuoted(name, '"'), key_idx);
+	}
+	switch (relation.staged_type) {
+	case ReplicatedChangeType::INSERT: {
+		if (relation.HasKey()) {
+			// remove rows with the same key first - this makes re-applying changes that are already present in the
+			// table (e.g. because they were copied after the replication slot was created) idempotent
+			auto delete_query =
+			    StringUtil::Format("DELETE FROM %s AS t USING %s AS s WHERE %s", target, stage, key_condition);
+			ExecuteQuery(connection, delete_query);
+		}
+		string column_names;
+		string stage_columns;
+		for (idx_t col_idx = 0; col_idx < relation.ColumnCount(); col_idx++) {
+			if (col_idx > 0) {
+				column_names += ", ";
+				stage_columns += ", ";
+			}
+			column_names += KeywordHelper::WriteQuoted(relation.names[col_idx], '"');
+			stage_columns += StringUtil::Format("__col_%d", col_idx);
+		}
+		ExecuteQuery(connection, StringUtil::Format("INSERT INTO %s (%s) SELECT %s FROM %s", target, column_names,
+		                                            stage_columns, stage));
+		relation.inserted += relation.staged_count;
+		break;
+	}
+	case ReplicatedChangeType::UPDATE: {
+		string set_list;
+		for (idx_t col_idx = 0; col_idx < relation.ColumnCount(); col_idx++) {
+			if (col_idx > 0) {
+				set_list += ", ";
+			}
+			// unchanged (TOASTed) values are not sent - keep the current value of the table for them
+			auto name = KeywordHelper::WriteQuoted(relation.names[col_idx], '"');
+			set_list += StringUtil::Format("%s = CASE WHEN s.__unchanged_%d THEN t.%s ELSE s.__col_%d END", name,
+			                               col_idx, name, col_idx);
+		}
+		ExecuteQuery(connection, StringUtil::Format("UPDATE %s AS t SET %s FROM %s AS s WHERE %s", target, set_list,
+		                                            stage, key_condition));
+		relation.updated += relation.staged_count;
+		break;
+	}
+	case ReplicatedChangeType::DELETE:
+		ExecuteQuery(connection,
+		             StringUtil::Format("DELETE FROM %s AS t USING %s AS s WHERE %s", target, stage, key_condition));
+		relation.deleted += relation.staged_count;
+		break;
+	default:
+		throw InternalException("Unsupported change type in postgres_replicate");
+	}
+	ExecuteQuery(connection, StringUtil::Format("DELETE FROM %s", stage));
+	relation.staged_type = ReplicatedChangeType::NONE;
+	relation.staged_count = 0;
+	relation.staged_keys.clear();
+}
+
+static void CreateStage(ReplicatedRelation &relation, Connection &connection, uint32_t relation_oid) {
+	relation.stage_name = StringUtil::Format("__postgres_replicate_%d", relation_oid);
+	auto info = make_uniq<CreateTableInfo>(TEMP_CATALOG, DEFAULT_SCHEMA, relation.stage_name);
+	info->temporary = true;
+	info->on_conflict = OnCreateConflict::REPLACE_ON_CONFLICT;
+	vector<LogicalType> stage_types;
+	for (idx_t key_idx = 0; key_idx < relation.KeyCount(); key_idx++) {
+		stage_types.push_back(relation.types[relation.key_columns[key_idx]]);
+		info->columns.AddColumn(ColumnDefinition(StringUtil::Format("__key_%d", key_idx), stage_types.back()));
+	}
+	for (idx_t col_idx = 0; col_idx < relation.ColumnCount(); col_idx++) {
+		stage_types.push_back(relation.types[col_idx]);
+		info->columns.AddColumn(ColumnDefinition(StringUtil::Format("__col_%d", col_idx), stage_types.back()));
+	}
+	for (idx_t col_idx = 0; col_idx < relation.ColumnCount(); col_idx++) {
+		stage_types.push_back(LogicalType::BOOLEAN);
+		info->columns.AddColumn(ColumnDefinition(StringUtil::Format("__unchanged_%d", col_idx), stage_types.back()));
+	}
+	auto &context = *connection.context;
+	context.RunFunctionInTransaction(
+	    [&]() { Catalog::GetCatalog(context, TEMP_CATALOG).CreateTable(context, std::move(info)); });
+	relation.stage = make_uniq<Appender>(connection, TEMP_CATALOG, DEFAULT_SCHEMA, relation.stage_name);
+	relation.stage_chunk.Initialize(Allocator::DefaultAllocator(), stage_types);
+}
+
+//! Types that the scanner reads by casting them to VARCHAR in Postgres cannot be decoded from the binary tuple data
+static bool SupportsBinaryTupleData(const PostgresType &type) {
+	if (type.info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
+		return false;
+	}
+	for (auto &child : type.children) {
+		if (!SupportsBinaryTupleData(child)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void ReadRelation(ClientContext &context, const PostgresReplicateBindData &bind_data,
+                         PostgresReplicateGlobalState &gstate, PgOutputDecoder &decoder) {
+	auto relation_oid = decoder.ReadInteger<uint32_t>();
+	auto schema_name = decoder.ReadCString();
+	auto table_name = decoder.ReadCString();
+	auto replica_identity = static_cast<char>(decoder.ReadInteger<uint8_t>());
+	auto column_count = decoder.ReadInteger<uint16_t>();
+
+	auto entry = gstate.relations.find(relation_oid);
+	if (entry != gstate.relations.end()) {
+		// the definition of a relation is re-sent - apply the changes staged so far using the old definition
+		ApplyStagedChanges(bind_data, gstate, *entry->second);
+		entry->second->stage.reset();
+	}
+	auto &table = bind_data.source.GetEntry<TableCatalogEntry>(context, schema_name, table_name)
+	                  .Cast<PostgresTableEntry>();
+	auto relation = make_uniq<ReplicatedRelation>();
+	relation->schema_name = schema_name;
+	relation->table_name = table_name;
+	relation->replica_identity = replica_identity;
+	for (auto &col : table.GetColumns().Logical()) {
+		relation->names.push_back(col.GetName());
+		relation->types.push_back(col.GetType());
+	}
+	relation->postgres_types = table.postgres_types;
+	for (idx_t col_idx = 0; col_idx < relation->ColumnCount(); col_idx++) {
+		if (!SupportsBinaryTupleData(relation->postgres_types[col_idx])) {
+			throw NotImplementedException("postgres_replicate: column \"%s\" of table \"%s\" has an unsupported type",
+			                              relation->names[col_idx], table_name);
+		}
+	}
+	for (idx_t i = 0; i < column_count; i++) {
+		auto flags = decoder.ReadInteger<uint8_t>();
+		auto column_name = decoder.ReadCString();
+		decoder.ReadInteger<uint32_t>(); // type oid
+		decoder.ReadInteger<int32_t>();  // type modifier
+		idx_t column_idx = DConstants::INVALID_INDEX;
+		for (idx_t col_idx = 0; col_idx < table.postgres_names.size(); col_idx++) {
+			if (table.postgres_names[col_idx] == column_name) {
+				column_idx = col_idx;
+				break;
+			}
+		}
+		if (column_idx == DConstants::INVALID_INDEX) {
+			throw InvalidInputException("postgres_replicate: column \"%s\" of table \"%s\" not found", column_name,
+			                            table_name);
+		}
+		relation->column_map.push_back(column_idx);
+		// flag 1 marks a column that is part of the replica identity
+		if (flags & 1) {
+			relation->key_columns.push_back(column_idx);
+		}
+	}
+	CreateStage(*relation, *gstate.connection, relation_oid);
+	if (entry == gstate.relations.end()) {
+		gstate.relation_order.push_back(*relation);
+		gstate.relations[relation_oid] = std::move(relation);
+	} else {
+		// carry over the counters of the previous definition
+		relation->inserted = entry->second->inserted;
+		relation->updated = entry->second->updated;
+		relation->deleted = entry->second->deleted;
+		for (auto &relation_ref : gstate.relation_order) {
+			if (&relation_ref.get() == entry->second.get()) {
+				relation_ref = *relation;
+			}
+		}
+		entry->second = std::move(relation);
+	}
+}
+
+//! Reads the tuple data of a change into a chunk that holds the columns of the table starting at column_offset
+//! If track_unchanged is set, the columns after them are set to whether or not a column was left out of the change
+static void ReadTuple(PgOutputDecoder &decoder, ReplicatedRelation &relation, DataChunk &chunk, idx_t column_offset,
+                      bool track_unchanged) {
+	auto column_count = decoder.ReadInteger<uint16_t>();
+	if (column_count != relation.column_map.size()) {
+		throw IOException("postgres_replicate: expected %d columns for table \"%s\" but got %d",
+		                  relation.column_map.size(), relation.table_name, column_count);
+	}
+	auto unchanged_offset = column_offset + relation.ColumnCount();
+	for (idx_t col_idx = 0; col_idx < relation.ColumnCount(); col_idx++) {
+		// columns that are not replicated (e.g. generated columns) keep their current value
+		FlatVector::SetNull(chunk.data[column_offset + col_idx], 0, true);
+		if (track_unchanged) {
+			chunk.SetValue(unchanged_offset + col_idx, 0, Value::BOOLEAN(true));
+		}
+	}
+	for (idx_t i = 0; i < column_count; i++) {
+		auto column_idx = relation.column_map[i];
+		auto &out_vec = chunk.data[column_offset + column_idx];
+		auto kind = decoder.ReadInteger<uint8_t>();
+		bool unchanged = false;
+		switch (kind) {
+		case 'n':
+			break;
+		case 'u':
+			// unchanged TOASTed value - it is not sent
+			unchanged = true;
+			break;
+		case 'b':
+			FlatVector::SetNull(out_vec, 0, false);
+			decoder.ReadValue(relation.types[column_idx], relation.postgres_types[column_idx], out_vec, 0);
+			break;
+		case 't': {
+			// types without a binary output function are sent as text
+			auto length = decoder.ReadInteger<uint32_t>();
+			auto text = decoder.ReadString(length);
+			chunk.SetValue(column_offset + column_idx, 0,
+			               Value(string(text, length)).DefaultCastAs(relation.types[column_idx]));
+			break;
+		}
+		default:
+			throw IOException("postgres_replicate: unsupported tuple data kind '%c'", kind);
+		}
+		if (track_unchanged) {
+			chunk.SetValue(unchanged_offset + column_idx, 0, Value::BOOLEAN(unchanged));
+		}
+	}
+}
+
+static string GetKey(DataChunk &chunk, const ReplicatedRelation &relation, idx_t column_offset) {
+	string key;
+	for (auto &col_idx : relation.key_columns) {
+		key += chunk.GetValue(column_offset + col_idx, 0).ToSQLString() + ",";
+	}
+	return key;
+}
+
+//! Stages a change - the staged changes are applied once a change of a different type arrives, or a change to a key
+//! that was already changed by the staged changes
+static void StageChange(const PostgresReplicateBindData &bind_data, PostgresReplicateGlobalState &gstate,
+                        PgOutputDecoder &decoder, ReplicatedChangeType type) {
+	auto relation_oid = decoder.ReadInteger<uint32_t>();
+	auto entry = gstate.relations.find(relation_oid);
+	if (entry == gstate.relations.end()) {
+		throw IOException("postgres_replicate: change for unknown relation %d", relation_oid);
+	}
+	auto &relation = *entry->second;
+	if (type != ReplicatedChangeType::INSERT && relation.key_columns.empty()) {
+		throw InvalidInputException("postgres_replicate: table \"%s\" has no replica identity", relation.table_name);
+	}
+	auto key_count = relation.KeyCount();
+	DataChunk change;
+	change.Initialize(Allocator::DefaultAllocator(), relation.stage_chunk.GetTypes(), 1);
+	change.SetCardinality(1);
+
+	// the old row is sent for deletes, and for updates that change the key or of tables with REPLICA IDENTITY FULL
+	DataChunk old_row;
+	auto tuple_type = decoder.ReadInteger<uint8_t>();
+	if (tuple_type == 'K' || tuple_type == 'O') {
+		old_row.Initialize(Allocator::DefaultAllocator(), relation.types, 1);
+		old_row.SetCardinality(1);
+		ReadTuple(decoder, relation, old_row, 0, false);
+		if (type != ReplicatedChangeType::DELETE) {
+			tuple_type = decoder.ReadInteger<uint8_t>();
+		}
+	} else if (type == ReplicatedChangeType::DELETE) {
+		throw IOException("postgres_replicate: expected the old tuple of a delete but got '%c'", tuple_type);
+	}
+	string key;
+	string new_key;
+	if (type == ReplicatedChangeType::DELETE) {
+		for (idx_t col_idx = key_count; col_idx < change.ColumnCount(); col_idx++) {
+			FlatVector::SetNull(change.data[col_idx], 0, true);
+		}
+	} else {
+		if (tuple_type != 'N') {
+			throw IOException("postgres_replicate: expected a new tuple but got '%c'", tuple_type);
+		}
+		ReadTuple(decoder, relation, change, key_count, true);
+		new_key = GetKey(change, relation, key_count);
+	}
+	// the key of the row before the change - it is only sent if it differs from the key of the new row
+	auto &key_source = old_row.ColumnCount() > 0 ? old_row : change;
+	auto key_offset = old_row.ColumnCount() > 0 ? 0 : key_count;
+	for (idx_t key_idx = 0; key_idx < key_count; key_idx++) {
+		change.SetValue(key_idx, 0, key_source.GetValue(key_offset + relation.key_columns[key_idx], 0));
+	}
+	key = GetKey(key_source, relation, key_offset);
+
+	bool apply_staged = relation.staged_type != type;
+	if (type != ReplicatedChangeType::INSERT || relation.HasKey()) {
+		apply_staged = apply_staged || relation.staged_keys.count(key) > 0 || relation.staged_keys.count(new_key) > 0;
+	}
+	if (apply_staged) {
+		ApplyStagedChanges(bind_data, gstate, relation);
+	}
+	relation.stage_chunk.Append(change);
+	relation.staged_type = type;
+	relation.staged_count++;
+	relation.staged_keys.insert(std::move(key));
+	if (!new_key.empty()) {
+		relation.staged_keys.insert(std::move(new_key));
+	}
+	if (relation.stage_chunk.size() == STANDARD_VECTOR_SIZE) {
+		relation.stage->AppendDataChunk(relation.stage_chunk);
+		relation.stage_chunk.Reset();
+	}
+}
+
+static void ReadTruncate(const PostgresReplicateBindData &bind_data, PostgresReplicateGlobalState &gstate,
+                         PgOutputDecoder &decoder) {
+	auto relation_count = decoder.ReadInteger<uint32_t>();
+	decoder.ReadInteger<uint8_t>(); // options (CASCADE / RESTART IDENTITY)
+	for (idx_t i = 0; i < relation_count; i++) {
+		auto relation_oid = decoder.ReadInteger<uint32_t>();
+		auto entry = gstate.relations.find(relation_oid);
+		if (entry == gstate.relations.end()) {
+			throw IOException("postgres_replicate: truncate of unknown relation %d", relation_oid);
+		}
+		auto &relation = *entry->second;
+		ApplyStagedChanges(bind_data, gstate, relation);
+		ExecuteQuery(*gstate.connection, "DELETE FROM " + GetTargetName(bind_data, relation));
+	}
+}
+
+static uint8_t HexToByte(char c) {
+	if (c >= '0' && c <= '9') {
+		return UnsafeNumericCast<uint8_t>(c - '0');
+	}
+	if (c >= 'a' && c <= 'f') {
+		return UnsafeNumericCast<uint8_t>(c - 'a' + 10);
+	}
+	throw IOException("postgres_replicate: invalid hex character in logical replication message");
+}
+
+static void ReplicateChanges(ClientContext &context, const PostgresReplicateBindData &bind_data,
+                             PostgresReplicateGlobalState &gstate) {
+	// changes are peeked (and not consumed) - the slot is only advanced after they have been committed locally
+	auto pool_connection = bind_data.source.GetConnectionPool().ForceGetConnection();
+	auto &con = pool_connection.GetConnection();
+	auto slot_name = KeywordHelper::WriteQuoted(bind_data.slot_name);
+	auto max_changes = bind_data.max_changes == 0 ? string("NULL") : to_string(bind_data.max_changes);
+	auto publication = KeywordHelper::WriteQuoted(PostgresUtils::QuotePostgresIdentifier(bind_data.publication));
+	auto result = con.Query(StringUtil::Format(
+	    "SELECT encode(data, 'hex') FROM pg_logical_slot_peek_binary_changes(%s, NULL, %s, 'proto_version', '1', "
+	    "'publication_names', %s, 'binary', 'true')",
+	    slot_name, max_changes, publication));
+
+	gstate.connection = make_uniq<Connection>(*context.db);
+	gstate.connection->BeginTransaction();
+	// the end of the last transaction that was received
+	uint64_t confirmed_lsn = 0;
+	vector<data_t> message;
+	for (idx_t row = 0; row < result->Count(); row++) {
+		auto hex = result->GetStringRef(row, 0);
+		auto hex_data = hex.GetData();
+		message.resize(hex.GetSize() / 2);
+		for (idx_t i = 0; i < message.size(); i++) {
+			message[i] = UnsafeNumericCast<data_t>(HexToByte(hex_data[2 * i]) << 4 | HexToByte(hex_data[2 * i + 1]));
+		}
+		PgOutputDecoder decoder(message.data(), message.size());
+		auto message_type = decoder.ReadInteger<uint8_t>();
+		switch (message_type) {
+		case 'B':
+			// begin - the changes of a transaction are only sent once it has committed
+			break;
+		case 'C':
+			decoder.ReadInteger<uint8_t>();  // flags
+			decoder.ReadInteger<uint64_t>(); // commit LSN
+			confirmed_lsn = decoder.ReadInteger<uint64_t>();
+			break;
+		case 'R':
+			ReadRelation(context, bind_data, gstate, decoder);
+			break;
+		case 'I':
+			StageChange(bind_data, gstate, decoder, ReplicatedChangeType::INSERT);
+			break;
+		case 'U':
+			StageChange(bind_data, gstate, decoder, ReplicatedChangeType::UPDATE);
+			break;
+		case 'D':
+			StageChange(bind_data, gstate, decoder, ReplicatedChangeType::DELETE);
+			break;
+		case 'T':
+			ReadTruncate(bind_data, gstate, decoder);
+			break;
+		case 'Y':
+		case 'O':
+		case 'M':
+			// types, origins and logical messages are not needed to apply the changes
+			break;
+		default:
+			throw IOException("postgres_replicate: unsupported logical replication message '%c'", message_type);
+		}
+	}
+	result.reset();
+	for (auto &relation : gstate.relation_order) {
+		ApplyStagedChanges(bind_data, gstate, relation.get());
+	}
+	gstate.connection->Commit();
+	if (confirmed_lsn != 0) {
+		con.Query(StringUtil::Format("SELECT pg_replication_slot_advance(%s, '%X/%X')", slot_name, confirmed_lsn >> 32,
+		                             confirmed_lsn & 0xFFFFFFFF));
+	}
+}
+
+static void PostgresReplicateScan(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
+	auto &bind_data = data.bind_data->Cast<PostgresReplicateBindData>();
+	auto &gstate = data.global_state->Cast<PostgresReplicateGlobalState>();
+	if (!gstate.finished) {
+		ReplicateChanges(context, bind_data, gstate);
+		gstate.finished = true;
+	}
+	idx_t count = 0;
+	for (; gstate.result_offset < gstate.relation_order.size() && count < STANDARD_VECTOR_SIZE;
+	     gstate.result_offset++) {
+		auto &relation = gstate.relation_order[gstate.result_offset].get();
+		output.SetValue(0, count, Value(relation.schema_name));
+		output.SetValue(1, count, Value(relation.table_name));
+		output.SetValue(2, count, Value::BIGINT(NumericCast<int64_t>(relation.inserted)));
+		output.SetValue(3, count, Value::BIGINT(NumericCast<int64_t>(relation.updated)));
+		output.SetValue(4, count, Value::BIGINT(NumericCast<int64_t>(relation.deleted)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+PostgresReplicateFunction::PostgresReplicateFunction()
+    : TableFunction("postgres_replicate",
+                    {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
+                    PostgresReplicateScan, PostgresReplicateBind, PostgresReplicateInitGlobalState) {
+	named_parameters["max_changes"] = LogicalType::UBIGINT;
+}
+
+} // namespace duckdb
@@ -0,0 +1,129 @@
+#include "duckdb.hpp"
+
+#include "postgres_scanner.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "storage/postgres_catalog.hpp"
+#include "storage/postgres_table_entry.hpp"
+#include "storage/postgres_transaction.hpp"
+
+namespace duckdb {
+
+//! Transaction ids in a tuple are 32-bit - they can only be compared if they are less than 2^31 transactions apart
+static constexpr idx_t POSTGRES_XID_MAX_DISTANCE = idx_t(1) << 31;
+
+static PostgresCatalog &GetPostgresCatalog(ClientContext &context, const Value &db_name_p, const string &function) {
+	if (db_name_p.IsNull()) {
+		throw BinderException("The database parameter of %s cannot be NULL", function);
+	}
+	auto db_name = db_name_p.GetValue<string>();
+	auto &db_manager = DatabaseManager::Get(context);
+	auto db = db_manager.GetDatabase(context, db_name);
+	if (!db) {
+		throw BinderException("Failed to find attached database \"%s\" referenced in %s", db_name, function);
+	}
+	auto &catalog = db->GetCatalog();
+	if (catalog.GetCatalogType() != "postgres") {
+		throw BinderException("Attached database \"%s\" does not refer to a Postgres database", db_name);
+	}
+	return catalog.Cast<PostgresCatalog>();
+}
+
+idx_t PostgresChangeWatermarkFunction::GetWatermark(PostgresVersion version, PostgresConnection &con) {
+	// both functions return the 64-bit transaction id, i.e. including the epoch
+	string query = version.major_v >= 13 ? "SELECT pg_snapshot_xmin(pg_current_snapshot())::TEXT::BIGINT"
+	                                     : "SELECT txid_snapshot_xmin(txid_current_snapshot())";
+	auto result = con.Query(query);
+	return NumericCast<idx_t>(result->GetInt64(0, 0));
+}
+
+static unique_ptr<FunctionData> PGScanChangesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                  vector<LogicalType> &return_types, vector<string> &names) {
+	auto &pg_catalog = GetPostgresCatalog(context, input.inputs[0], "postgres_scan_changes");
+	for (idx_t i = 1; i < input.inputs.size(); i++) {
+		if (input.inputs[i].IsNull()) {
+			throw BinderException("Parameters to postgres_scan_changes cannot be NULL");
+		}
+	}
+	auto schema_name = input.inputs[1].GetValue<string>();
+	auto table_name = input.inputs[2].GetValue<string>();
+	auto since_xid = UBigIntValue::Get(input.inputs[3]);
+
+	auto &table = pg_catalog.GetEntry<TableCatalogEntry>(context, schema_name, table_name).Cast<PostgresTableEntry>();
+	unique_ptr<FunctionData> result;
+	table.GetScanFunction(context, result);
+	auto &bind_data = result->Cast<PostgresBindData>();
+	for (auto &col : table.GetColumns().Logical()) {
+		names.push_back(col.GetName());
+		return_types.push_back(col.GetType());
+	}
+	if (since_xid == 0) {
+		// no watermark yet - return all rows
+		return result;
+	}
+	auto &transaction = Transaction::Get(context, pg_catalog).Cast<PostgresTransaction>();
+	auto watermark =
+	    PostgresChangeWatermarkFunction::GetWatermark(pg_catalog.GetPostgresVersion(), transaction.GetConnection());
+	if (since_xid < watermark && watermark - since_xid >= POSTGRES_XID_MAX_DISTANCE) {
+		throw InvalidInputException("postgres_scan_changes: watermark %d is too old to find the changed rows of "
+		                            "table \"%s\" - the table needs to be fully re-read (pass 0 as watermark)",
+		                            since_xid, table_name);
+	}
+	// a row is changed since the watermark if it was written by the watermark transaction or any later one
+	// the comparison uses age() so that it keeps working after the 32-bit transaction ids wrap around
+	// frozen rows are never newer than the watermark - their age is the maximum age
+	bind_data.table_filter =
+	    StringUtil::Format("age(xmin) <= age('%d'::xid)", since_xid % (POSTGRES_XID_MAX_DISTANCE * 2));
+	return result;
+}
+
+struct PGChangeWatermarkBindData : public TableFunctionData {
+	explicit PGChangeWatermarkBindData(PostgresCatalog &pg_catalog) : pg_catalog(pg_catalog) {
+	}
+
+	bool finished = false;
+	PostgresCatalog &pg_catalog;
+};
+
+static unique_ptr<FunctionData> PGChangeWatermarkBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	auto &pg_catalog = GetPostgresCatalog(context, input.inputs[0], "postgres_change_watermark");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("watermark");
+	return make_uniq<PGChangeWatermarkBindData>(pg_catalog);
+}
+
+static void PGChangeWatermarkFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<PGChangeWatermarkBindData>();
+	if (data.finished) {
+		return;
+	}
+	// the watermark is read in the transaction of the catalog - scans of postgres_scan_changes in the same
+	// transaction see all rows that were written by transactions older than the watermark
+	auto &transaction = Transaction::Get(context, data.pg_catalog).Cast<PostgresTransaction>();
+	auto watermark = PostgresChangeWatermarkFunction::GetWatermark(data.pg_catalog.GetPostgresVersion(),
+	                                                               transaction.GetConnection());
+	output.SetValue(0, 0, Value::UBIGINT(watermark));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+PostgresScanChangesFunction::PostgresScanChangesFunction()
+    : TableFunction("postgres_scan_changes",
+                    {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::UBIGINT}, nullptr,
+                    PGScanChangesBind) {
+	PostgresScanFunction scan_function;
+	init_global = scan_function.init_global;
+	init_local = scan_function.init_local;
+	function = scan_function.function;
+	table_scan_progress = scan_function.table_scan_progress;
+	projection_pushdown = true;
+	global_initialization = TableFunctionInitialization::INITIALIZE_ON_SCHEDULE;
+}
+
+PostgresChangeWatermarkFunction::PostgresChangeWatermarkFunction()
+    : TableFunction("postgres_change_watermark", {LogicalType::VARCHAR}, PGChangeWatermarkFunction,
+                    PGChangeWatermarkBind) {
+}
+
+} // namespace duckdb
@@ -1,11 +1,13 @@
 #include "duckdb.hpp"
 
 #include <libpq-fe.h>
+#include <chrono>
 
 #include "duckdb/main/extension/extension_loader.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "postgres_filter_pushdown.hpp"
 #include "postgres_scanner.hpp"
 #include "postgres_result.hpp"
@@ -17,11 +19,11 @@
 
 namespace duckdb {
 
-static constexpr uint32_t POSTGRES_TID_MAX = 4294967295;
-
 struct PostgresGlobalState;
 
 struct PostgresLocalState : public LocalTableFunctionState {
+	~PostgresLocalState() override;
+
 	bool done = false;
 	bool exec = false;
 	bool no_connection = false;
@@ -32,15 +34,21 @@ struct PostgresLocalState : public LocalTableFunctionState {
 	PostgresConnection connection;
 	idx_t batch_idx = 0;
 	PostgresPoolConnection pool_connection;
+	//! Whether or not a running scan can be cancelled on the server (i.e. the connection is not shared with the
+	//! transaction of the user)
+	bool can_cancel = false;
 	unique_ptr<PostgresResultReader> reader;
 
 	void ScanChunk(ClientContext &context, const PostgresBindData &bind_data, PostgresGlobalState &gstate,
 	               DataChunk &output);
+	//! Moves the statistics collected by the reader into the global state
+	void FlushStatistics(PostgresGlobalState &gstate);
 };
 
 struct PostgresGlobalState : public GlobalTableFunctionState {
 	explicit PostgresGlobalState(idx_t max_threads) : page_idx(0), batch_idx(0), max_threads(max_threads) {
 	}
+	~PostgresGlobalState() override;
 
 	mutable mutex lock;
 	idx_t page_idx;
@@ -50,6 +58,8 @@ struct PostgresGlobalState : public GlobalTableFunctionState {
 	ColumnDataScanState scan_state;
 	bool used_main_thread = false;
 	string snapshot;
+	//! Statistics of all readers of this scan - reported through EXPLAIN ANALYZE
+	PostgresReadStatistics stats;
 
 	PostgresConnection &GetConnection();
 	void SetConnection(PostgresConnection connection);
@@ -60,45 +70,75 @@ struct PostgresGlobalState : public GlobalTableFunctionState {
 		return max_threads;
 	}
 
+	//! The pooled connection backing the main connection of a stand-alone scan
+	PostgresPoolConnection pool_connection;
+
 private:
 	PostgresConnection connection;
 };
 
-static void PostgresGetSnapshot(PostgresVersion version, const PostgresBindData &bind_data,
-                                PostgresGlobalState &gstate) {
-	unique_ptr<PostgresResult> result;
-	// by default disable snapshotting
-	gstate.snapshot = string();
-	if (gstate.max_threads <= 1) {
+void PostgresScanFunction::EndScanTransaction(PostgresPoolConnection &pool_connection) {
+	if (!pool_connection.HasConnection()) {
 		return;
 	}
-	if (version.type_v == PostgresInstanceType::AURORA) {
+	// end the read-only scan transaction so the connection can be re-used by the connection pool
+	auto &connection = pool_connection.GetConnection();
+	if (!connection.IsOpen() || PQstatus(connection.GetConn()) != CONNECTION_OK) {
 		return;
 	}
-	// reader threads can use the same snapshot
-	auto &con = gstate.GetConnection();
+	auto status = PQtransactionStatus(connection.GetConn());
+	if (status == PQTRANS_INTRANS || status == PQTRANS_INERROR) {
+		connection.TryQuery("ROLLBACK");
+	}
+}
+
+PostgresLocalState::~PostgresLocalState() {
+	reader.reset();
+	PostgresScanFunction::EndScanTransaction(pool_connection);
+}
+
+PostgresGlobalState::~PostgresGlobalState() {
+	connection.Close();
+	PostgresScanFunction::EndScanTransaction(pool_connection);
+}
+
+string PostgresScanFunction::ExportSnapshot(PostgresVersion version, PostgresConnection &con) {
+	if (version.type_v == PostgresInstanceType::AURORA) {
+		return string();
+	}
+	unique_ptr<PostgresResult> result;
 	// pg_stat_wal_receiver was introduced in PostgreSQL 9.6
 	if (version < PostgresVersion(9, 6, 0)) {
 		result = con.TryQuery("SELECT pg_is_in_recovery(), pg_export_snapshot()");
 		if (result) {
 			auto in_recovery = result->GetBool(0, 0);
 			if (!in_recovery) {
-				gstate.snapshot = result->GetString(0, 1);
+				return result->GetString(0, 1);
 			}
 		}
-		return;
+		return string();
 	}
 
 	result =
 	    con.TryQuery("SELECT pg_is_in_recovery(), pg_export_snapshot(), (select count(*) from pg_stat_wal_receiver)");
 	if (result) {
 		auto in_recovery = result->GetBool(0, 0) || result->GetInt64(0, 2) > 0;
-		gstate.snapshot = "";
 		if (!in_recovery) {
-			gstate.snapshot = result->GetString(0, 1);
+			return result->GetString(0, 1);
 		}
+	}
+	return string();
+}
+
+static void PostgresGetSnapshot(PostgresVersion version, const PostgresBindData &bind_data,
+                                PostgresGlobalState &gstate) {
+	// by default disable snapshotting
+	gstate.snapshot = string();
+	if (gstate.max_threads <= 1) {
 		return;
 	}
+	// reader threads can use the same snapshot
+	gstate.snapshot = PostgresScanFunction::ExportSnapshot(version, gstate.GetConnection());
 }
 
 void PostgresScanFunction::PrepareBind(PostgresVersion version, ClientContext &context, PostgresBindData &bind_data,
@@ -178,7 +218,15 @@ static unique_ptr<FunctionData> PostgresBind(ClientContext &context, TableFuncti
 	bind_data->schema_name = input.inputs[1].GetValue<string>();
 	bind_data->table_name = input.inputs[2].GetValue<string>();
 
-	auto con = PostgresConnection::Open(bind_data->dsn);
+	idx_t maximum_connections = PostgresConnectionPool::DEFAULT_MAX_CONNECTIONS;
+	Value connection_limit;
+	if (context.TryGetCurrentSetting("pg_connection_limit", connection_limit)) {
+		maximum_connections = UBigIntValue::Get(connection_limit);
+	}
+	bind_data->connection_pool = PostgresConnectionPool::GetPool(bind_data->dsn, maximum_connections);
+	// the connection goes back to the pool when binding finishes - the scan then takes the idle connection again
+	auto pool_connection = bind_data->connection_pool->ForceGetConnection();
+	auto &con = pool_connection.GetConnection();
 	auto version = con.GetPostgresVersion();
 	// query the table schema so we can interpret the bits in the pages
 	auto info = PostgresTableSet::GetTableInfo(con, bind_data->schema_name, bind_data->table_name);
@@ -209,82 +257,87 @@ static bool ContainsCastToVarchar(const PostgresType &type) {
 	return false;
 }
 
-static void PostgresInitInternal(ClientContext &context, const PostgresBindData *bind_data_p,
-                                 PostgresLocalState &lstate, idx_t task_min, idx_t task_max) {
-	D_ASSERT(bind_data_p);
+string PostgresScanFunction::GetScanQuery(const PostgresBindData &bind_data, const vector<column_t> &column_ids,
+                                          optional_ptr<TableFilterSet> filters, idx_t task_min, idx_t task_max) {
 	D_ASSERT(task_min <= task_max);
 
-	auto bind_data = (const PostgresBindData *)bind_data_p;
-
 	string col_names;
-	for (auto &column_id : lstate.column_ids) {
+	for (auto &column_id : column_ids) {
 		if (!col_names.empty()) {
 			col_names += ", ";
 		}
 		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
-			if (bind_data->table_name.empty() || !bind_data->emit_ctid) {
+			if (bind_data.table_name.empty() || !bind_data.emit_ctid) {
 				// count(*) over postgres_query
 				col_names += "NULL";
 			} else {
 				col_names += "ctid";
 			}
 		} else {
-			col_names += KeywordHelper::WriteQuoted(bind_data->names[column_id], '"');
-			if (bind_data->postgres_types[column_id].info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
+			col_names += KeywordHelper::WriteQuoted(bind_data.names[column_id], '"');
+			if (bind_data.postgres_types[column_id].info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
 				col_names += "::VARCHAR";
-			} else if (bind_data->types[column_id].id() == LogicalTypeId::LIST) {
-				if (bind_data->postgres_types[column_id].info != PostgresTypeAnnotation::STANDARD) {
+			} else if (bind_data.types[column_id].id() == LogicalTypeId::LIST) {
+				if (bind_data.postgres_types[column_id].info != PostgresTypeAnnotation::STANDARD) {
 					continue;
 				}
-				if (bind_data->postgres_types[column_id].children[0].info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
+				if (bind_data.postgres_types[column_id].children[0].info == PostgresTypeAnnotation::CAST_TO_VARCHAR) {
 					col_names += "::VARCHAR[]";
 				}
 			} else {
-				if (ContainsCastToVarchar(bind_data->postgres_types[column_id])) {
+				if (ContainsCastToVarchar(bind_data.postgres_types[column_id])) {
 					throw NotImplementedException("Error reading table \"%s\" - cast to varchar not implemented for "
 					                              "composite column \"%s\" (type %s)",
-					                              bind_data->table_name, bind_data->names[column_id],
-					                              bind_data->types[column_id].ToString());
+					                              bind_data.table_name, bind_data.names[column_id],
+					                              bind_data.types[column_id].ToString());
 				}
 			}
 		}
 	}
 
-	string filter_string =
-	    PostgresFilterPushdown::TransformFilters(lstate.column_ids, lstate.filters, bind_data->names);
+	string filter_string = PostgresFilterPushdown::TransformFilters(column_ids, filters, bind_data.names);
 
 	string filter;
-
-	lstate.exec = false;
-	lstate.done = false;
-	if (bind_data->pages_approx > 0) {
+	if (bind_data.pages_approx > 0) {
 		filter = StringUtil::Format("WHERE ctid BETWEEN '(%d,0)'::tid AND '(%d,0)'::tid", task_min, task_max);
 	}
-	if (!filter_string.empty()) {
+	for (const string &condition : {filter_string, bind_data.table_filter}) {
+		if (condition.empty()) {
+			continue;
+		}
 		if (filter.empty()) {
 			filter += "WHERE ";
 		} else {
 			filter += " AND ";
 		}
-		filter += filter_string;
+		filter += condition;
 	}
 	string query;
-	if (bind_data->table_name.empty()) {
-		D_ASSERT(!bind_data->sql.empty());
-		query = StringUtil::Format(R"(SELECT %s FROM (%s) AS __unnamed_subquery %s%s)", col_names, bind_data->sql,
-		                           filter, bind_data->limit);
+	if (bind_data.table_name.empty()) {
+		D_ASSERT(!bind_data.sql.empty());
+		query = StringUtil::Format(R"(SELECT %s FROM (%s) AS __unnamed_subquery %s%s)", col_names, bind_data.sql,
+		                           filter, bind_data.limit);
 
 	} else {
 		query = StringUtil::Format(R"(SELECT %s FROM %s.%s %s%s)", col_names,
-		                           KeywordHelper::WriteQuoted(bind_data->schema_name, '"'),
-		                           KeywordHelper::WriteQuoted(bind_data->table_name, '"'), filter, bind_data->limit);
+		                           KeywordHelper::WriteQuoted(bind_data.schema_name, '"'),
+		                           KeywordHelper::WriteQuoted(bind_data.table_name, '"'), filter, bind_data.limit);
 	}
-	if (!bind_data->use_text_protocol) {
+	if (!bind_data.use_text_protocol) {
 		query = StringUtil::Format(R"(COPY (%s) TO STDOUT (FORMAT "binary");)", query);
 	} else {
 		query += ";";
 	}
-	lstate.sql = std::move(query);
+	return query;
+}
+
+static void PostgresInitInternal(ClientContext &context, const PostgresBindData *bind_data_p,
+                                 PostgresLocalState &lstate, idx_t task_min, idx_t task_max) {
+	D_ASSERT(bind_data_p);
+	lstate.exec = false;
+	lstate.done = false;
+	lstate.sql =
+	    PostgresScanFunction::GetScanQuery(*bind_data_p, lstate.column_ids, lstate.filters, task_min, task_max);
 }
 
 static idx_t PostgresMaxThreads(ClientContext &context, const FunctionData *bind_data_p) {
@@ -299,13 +352,21 @@ static idx_t PostgresMaxThreads(ClientContext &context, const FunctionData *bind
 static unique_ptr<LocalTableFunctionState> GetLocalState(ClientContext &context, TableFunctionInitInput &input,
                                                          PostgresGlobalState &gstate);
 
-static void PostgresScanConnect(PostgresConnection &conn, string snapshot) {
+void PostgresScanFunction::BeginScanTransaction(PostgresConnection &conn, const string &snapshot) {
 	conn.Execute("BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY");
 	if (!snapshot.empty()) {
 		conn.Query(StringUtil::Format("SET TRANSACTION SNAPSHOT '%s'", snapshot));
 	}
 }
 
+static PostgresConnectionPool &GetConnectionPool(const PostgresBindData &bind_data) {
+	auto pg_catalog = bind_data.GetCatalog();
+	if (pg_catalog) {
+		return pg_catalog->GetConnectionPool();
+	}
+	return *bind_data.connection_pool;
+}
+
 static unique_ptr<GlobalTableFunctionState> PostgresInitGlobalState(ClientContext &context,
                                                                     TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<PostgresBindData>();
@@ -317,11 +378,12 @@ static unique_ptr<GlobalTableFunctionState> PostgresInitGlobalState(ClientContex
 		    bind_data.use_transaction ? transaction.GetConnection() : transaction.GetConnectionWithoutTransaction();
 		result->SetConnection(con.GetConnection());
 	} else {
-		auto con = PostgresConnection::Open(bind_data.dsn);
+		result->pool_connection = bind_data.connection_pool->ForceGetConnection();
+		auto &con = result->pool_connection.GetConnection();
 		if (bind_data.use_transaction) {
-			PostgresScanConnect(con, string());
+			PostgresScanFunction::BeginScanTransaction(con, string());
 		}
-		result->SetConnection(std::move(con));
+		result->SetConnection(con.GetConnection());
 	}
 	if (bind_data.requires_materialization) {
 		// if requires_materialization is enabled we scan and materialize the table in its entirety up-front
@@ -350,6 +412,17 @@ static unique_ptr<GlobalTableFunctionState> PostgresInitGlobalState(ClientContex
 	} else {
 		// we create a transaction here, and get the snapshot id to enable transaction-safe parallelism
 		PostgresGetSnapshot(bind_data.version, bind_data, *result);
+		if (result->max_threads > 1) {
+			// open the connections for the worker threads concurrently up-front
+			// this avoids every thread paying for a (serial) connection handshake when the scan starts
+			auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+			auto worker_count = MinValue<idx_t>(result->max_threads, thread_count);
+			if (bind_data.can_use_main_thread) {
+				// the main thread re-uses the transaction connection
+				worker_count--;
+			}
+			GetConnectionPool(bind_data).WarmUp(worker_count);
+		}
 	}
 	return std::move(result);
 }
@@ -378,32 +451,31 @@ static bool PostgresParallelStateNext(ClientContext &context, const FunctionData
 
 bool PostgresGlobalState::TryOpenNewConnection(ClientContext &context, PostgresLocalState &lstate,
                                                const PostgresBindData &bind_data) {
-	auto pg_catalog = bind_data.GetCatalog();
 	{
 		lock_guard<mutex> parallel_lock(lock);
 		if (!used_main_thread) {
 			if (bind_data.can_use_main_thread) {
 				lstate.connection = PostgresConnection(GetConnection().GetConnection());
+				// the main connection of a catalog scan belongs to the transaction - cancelling would abort it
+				lstate.can_cancel = !bind_data.GetCatalog() || !bind_data.use_transaction;
 			} else {
 				// we cannot use the main thread but we haven't initiated ANY scan yet
 				// we HAVE to open a new connection
-				lstate.pool_connection = pg_catalog->GetConnectionPool().ForceGetConnection();
+				lstate.pool_connection = GetConnectionPool(bind_data).ForceGetConnection();
 				lstate.connection = PostgresConnection(lstate.pool_connection.GetConnection().GetConnection());
+				lstate.can_cancel = true;
 			}
 			used_main_thread = true;
 			return true;
 		}
 	}
 
-	if (pg_catalog) {
-		if (!pg_catalog->GetConnectionPool().TryGetConnection(lstate.pool_connection)) {
-			return false;
-		}
-		lstate.connection = PostgresConnection(lstate.pool_connection.GetConnection().GetConnection());
-	} else {
-		lstate.connection = PostgresConnection::Open(bind_data.dsn);
+	if (!GetConnectionPool(bind_data).TryGetConnection(lstate.pool_connection)) {
+		return false;
 	}
-	PostgresScanConnect(lstate.connection, snapshot);
+	lstate.connection = PostgresConnection(lstate.pool_connection.GetConnection().GetConnection());
+	lstate.can_cancel = true;
+	PostgresScanFunction::BeginScanTransaction(lstate.connection, snapshot);
 	return true;
 }
 
@@ -446,7 +518,7 @@ void PostgresLocalState::ScanChunk(ClientContext &context, const PostgresBindDat
 		if (bind_data.use_text_protocol) {
 			reader = make_uniq<PostgresTextReader>(context, connection, column_ids, bind_data);
 		} else {
-			reader = make_uniq<PostgresBinaryReader>(connection, column_ids, bind_data);
+			reader = make_uniq<PostgresBinaryReader>(context, connection, column_ids, bind_data, can_cancel);
 		}
 	}
 	while (true) {
@@ -457,17 +529,38 @@ void PostgresLocalState::ScanChunk(ClientContext &context, const PostgresBindDat
 			reader->BeginCopy(sql);
 			exec = true;
 		}
+		auto &stats = reader->GetStatistics();
+		auto network_wait_time = stats.network_wait_time;
+		auto row_count = output.size();
+		auto start = std::chrono::steady_clock::now();
 		auto read_result = reader->Read(output);
+		auto elapsed = NumericCast<idx_t>(std::chrono::nanoseconds(std::chrono::steady_clock::now() - start).count());
+		// everything that is not spent waiting on the server is spent decoding
+		auto wait_time = stats.network_wait_time - network_wait_time;
+		stats.decode_time += elapsed > wait_time ? elapsed - wait_time : 0;
+		stats.rows += output.size() - row_count;
 		if (read_result == PostgresReadResult::FINISHED) {
 			done = true;
+			FlushStatistics(gstate);
 			continue;
 		}
 		if (output.size() == STANDARD_VECTOR_SIZE) {
+			FlushStatistics(gstate);
 			return;
 		}
 	}
 }
 
+void PostgresLocalState::FlushStatistics(PostgresGlobalState &gstate) {
+	if (!reader) {
+		return;
+	}
+	auto &stats = reader->GetStatistics();
+	lock_guard<mutex> parallel_lock(gstate.lock);
+	gstate.stats.Merge(stats);
+	stats = PostgresReadStatistics();
+}
+
 static void PostgresScan(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
 	auto &bind_data = data.bind_data->Cast<PostgresBindData>();
 	auto &gstate = data.global_state->Cast<PostgresGlobalState>();
@@ -500,6 +593,29 @@ static InsertionOrderPreservingMap<string> PostgresScanToString(TableFunctionToS
 	return result;
 }
 
+static string FormatNanoseconds(idx_t nanoseconds) {
+	return StringUtil::Format("%.3fms", double(nanoseconds) / 1000000.0);
+}
+
+static InsertionOrderPreservingMap<string> PostgresScanDynamicToString(TableFunctionDynamicToStringInput &input) {
+	InsertionOrderPreservingMap<string> result;
+	if (!input.global_state) {
+		return result;
+	}
+	auto &gstate = input.global_state->Cast<PostgresGlobalState>();
+	if (input.local_state) {
+		input.local_state->Cast<PostgresLocalState>().FlushStatistics(gstate);
+	}
+	lock_guard<mutex> parallel_lock(gstate.lock);
+	auto &stats = gstate.stats;
+	result["Rows Received"] = to_string(stats.rows);
+	result["Bytes Received"] = to_string(stats.bytes_received);
+	result["COPY Messages"] = to_string(stats.copy_messages);
+	result["Network Wait"] = FormatNanoseconds(stats.network_wait_time);
+	result["Decode Time"] = FormatNanoseconds(stats.decode_time);
+	return result;
+}
+
 unique_ptr<NodeStatistics> PostgresScanCardinality(ClientContext &context, const FunctionData *bind_data_p) {
 	auto &bind_data = bind_data_p->Cast<PostgresBindData>();
 	// see https://www.postgresql.org/docs/current/storage-page-layout.html
@@ -547,6 +663,7 @@ PostgresScanFunction::PostgresScanFunction()
     : TableFunction("postgres_scan", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR}, PostgresScan,
                     PostgresBind, PostgresInitGlobalState, PostgresInitLocalState) {
 	to_string = PostgresScanToString;
+	dynamic_to_string = PostgresScanDynamicToString;
 	serialize = PostgresScanSerialize;
 	deserialize = PostgresScanDeserialize;
 	get_partition_data = PostgresGetPartitionData;
@@ -561,6 +678,7 @@ PostgresScanFunctionFilterPushdown::PostgresScanFunctionFilterPushdown()
     : TableFunction("postgres_scan_pushdown", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
                     PostgresScan, PostgresBind, PostgresInitGlobalState, PostgresInitLocalState) {
 	to_string = PostgresScanToString;
+	dynamic_to_string = PostgresScanDynamicToString;
 	serialize = PostgresScanSerialize;
 	deserialize = PostgresScanDeserialize;
 	get_partition_data = PostgresGetPartitionData;
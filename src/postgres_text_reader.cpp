@@ -2,6 +2,8 @@
 #include "postgres_scanner.hpp"
 #include "duckdb/common/types/blob.hpp"
 
+#include <chrono>
+
 namespace duckdb {
 
 PostgresTextReader::PostgresTextReader(ClientContext &context, PostgresConnection &con_p,
@@ -14,7 +16,11 @@ PostgresTextReader::~PostgresTextReader() {
 }
 
 void PostgresTextReader::BeginCopy(const string &sql) {
+	// the result is received in its entirety while executing the query
+	auto start = std::chrono::steady_clock::now();
 	result = con.Query(sql);
+	auto elapsed = std::chrono::steady_clock::now() - start;
+	stats.network_wait_time += NumericCast<idx_t>(std::chrono::nanoseconds(elapsed).count());
 	row_offset = 0;
 }
 
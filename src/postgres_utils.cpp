@@ -3,6 +3,18 @@
 #include "storage/postgres_transaction.hpp"
 #include "postgres_type_oids.hpp"
 
+#include <chrono>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#define pg_poll WSAPoll
+typedef WSAPOLLFD pg_pollfd_t;
+#else
+#include <poll.h>
+#define pg_poll poll
+typedef struct pollfd pg_pollfd_t;
+#endif
+
 namespace duckdb {
 
 static void PGNoticeProcessor(void *arg, const char *message) {
@@ -19,6 +31,132 @@ PGconn *PostgresUtils::PGConnect(const string &dsn) {
 	return conn;
 }
 
+static bool PGWaitForSocket(PGconn *conn, short events, int timeout_ms) {
+	pg_pollfd_t fd;
+	fd.fd = PQsocket(conn);
+	fd.events = events;
+	fd.revents = 0;
+	auto poll_result = pg_poll(&fd, 1, timeout_ms);
+	if (poll_result < 0 && errno != EINTR) {
+		throw IOException("Failed to wait for the Postgres connection: poll failed");
+	}
+	return poll_result > 0;
+}
+
+bool PostgresUtils::PGWaitForInput(PGconn *conn, int timeout_ms) {
+	return PGWaitForSocket(conn, POLLIN, timeout_ms);
+}
+
+bool PostgresUtils::PGWaitForOutput(PGconn *conn, int timeout_ms) {
+	// libpq reads any pending input while flushing - so we also wake up if data can be read
+	return PGWaitForSocket(conn, POLLIN | POLLOUT, timeout_ms);
+}
+
+static int GetConnectTimeoutMS(PGconn *conn) {
+	// PQconnectPoll does not enforce connect_timeout - it is up to the caller to honor it
+	int timeout_ms = -1;
+	auto options = PQconninfo(conn);
+	if (!options) {
+		return timeout_ms;
+	}
+	for (auto option = options; option->keyword; option++) {
+		if (strcmp(option->keyword, "connect_timeout") != 0 || !option->val) {
+			continue;
+		}
+		auto timeout_s = std::strtoll(option->val, nullptr, 10);
+		if (timeout_s > 0) {
+			// libpq enforces a minimum of 2 seconds
+			timeout_ms = int(MaxValue<int64_t>(timeout_s, 2) * 1000);
+		}
+	}
+	PQconninfoFree(options);
+	return timeout_ms;
+}
+
+vector<PGconn *> PostgresUtils::PGConnectParallel(const string &dsn, idx_t count) {
+	// start all connection attempts up-front and drive them concurrently using PQconnectPoll
+	// this means we pay for the TCP/TLS/auth round-trips of all connections at the same time
+	vector<PGconn *> pending;
+	vector<PostgresPollingStatusType> poll_status;
+	vector<PGconn *> result;
+	string error;
+	for (idx_t i = 0; i < count; i++) {
+		auto conn = PQconnectStart(dsn.c_str());
+		if (PQstatus(conn) == CONNECTION_BAD) {
+			error = string(PQerrorMessage(conn));
+			PQfinish(conn);
+			break;
+		}
+		pending.push_back(conn);
+		// before the first PQconnectPoll call we behave as if it last returned PGRES_POLLING_WRITING
+		poll_status.push_back(PGRES_POLLING_WRITING);
+	}
+	// connect_timeout bounds the entire handshake - not every wait for a single round-trip
+	int timeout_ms = pending.empty() ? -1 : GetConnectTimeoutMS(pending[0]);
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(MaxValue<int>(timeout_ms, 0));
+	vector<pg_pollfd_t> poll_fds;
+	while (error.empty() && !pending.empty()) {
+		int remaining_ms = -1;
+		if (timeout_ms >= 0) {
+			auto remaining = deadline - std::chrono::steady_clock::now();
+			auto remaining_count = std::chrono::duration_cast<std::chrono::milliseconds>(remaining).count();
+			if (remaining_count <= 0) {
+				error = "timeout expired";
+				break;
+			}
+			remaining_ms = int(remaining_count);
+		}
+		poll_fds.clear();
+		for (idx_t i = 0; i < pending.size(); i++) {
+			pg_pollfd_t fd;
+			fd.fd = PQsocket(pending[i]);
+			fd.events = poll_status[i] == PGRES_POLLING_READING ? POLLIN : POLLOUT;
+			fd.revents = 0;
+			poll_fds.push_back(fd);
+		}
+		auto poll_result = pg_poll(poll_fds.data(), poll_fds.size(), remaining_ms);
+		if (poll_result < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			error = "failed to poll connection sockets";
+			break;
+		}
+		if (poll_result == 0) {
+			error = "timeout expired";
+			break;
+		}
+		// advance all connections that are ready, back-to-front so we can erase finished ones
+		for (idx_t i = pending.size(); i > 0; i--) {
+			auto idx = i - 1;
+			if (poll_fds[idx].revents == 0) {
+				continue;
+			}
+			poll_status[idx] = PQconnectPoll(pending[idx]);
+			if (poll_status[idx] == PGRES_POLLING_FAILED) {
+				error = string(PQerrorMessage(pending[idx]));
+				break;
+			}
+			if (poll_status[idx] == PGRES_POLLING_OK) {
+				PQsetNoticeProcessor(pending[idx], PGNoticeProcessor, nullptr);
+				result.push_back(pending[idx]);
+				pending.erase_at(idx);
+				poll_status.erase_at(idx);
+			}
+		}
+	}
+	if (!error.empty()) {
+		for (auto conn : pending) {
+			PQfinish(conn);
+		}
+		for (auto conn : result) {
+			PQfinish(conn);
+		}
+		throw IOException("Unable to connect to Postgres at %s: %s", dsn, error);
+	}
+	return result;
+}
+
 string PostgresUtils::TypeToString(const LogicalType &input) {
 	if (input.HasAlias()) {
 		if (StringUtil::CIEquals(input.GetAlias(), "wkb_blob")) {
@@ -86,6 +224,9 @@ LogicalType PostgresUtils::TypeToLogicalType(optional_ptr<PostgresTransaction> t
                                              optional_ptr<PostgresSchemaEntry> schema,
                                              const PostgresTypeData &type_info, PostgresType &postgres_type) {
 	auto &pgtypename = type_info.type_name;
+	if (type_info.type_oid != 0) {
+		postgres_type.oid = type_info.type_oid;
+	}
 
 	// postgres array types start with an _
 	if (StringUtil::StartsWith(pgtypename, "_")) {
@@ -111,6 +252,7 @@ LogicalType PostgresUtils::TypeToLogicalType(optional_ptr<PostgresTransaction> t
 		PostgresTypeData child_type_info;
 		child_type_info.type_name = pgtypename.substr(1);
 		child_type_info.type_modifier = type_info.type_modifier;
+		child_type_info.type_oid = type_info.element_oid;
 		PostgresType child_pg_type;
 		auto child_type = PostgresUtils::TypeToLogicalType(transaction, schema, child_type_info, child_pg_type);
 		// construct the child type based on the number of dimensions
@@ -493,4 +635,19 @@ string PostgresUtils::QuotePostgresIdentifier(const string &text) {
 	return KeywordHelper::WriteOptionallyQuoted(text, '"', false);
 }
 
+string PostgresUtils::EscapeConnectionString(const string &input) {
+	string result = "'";
+	for (auto c : input) {
+		if (c == '\\') {
+			result += "\\\\";
+		} else if (c == '\'') {
+			result += "\\'";
+		} else {
+			result += c;
+		}
+	}
+	result += "'";
+	return result;
+}
+
 } // namespace duckdb
@@ -0,0 +1,84 @@
+#include "storage/postgres_binary_file_scan.hpp"
+#include "postgres_binary_file_reader.hpp"
+
+namespace duckdb {
+
+PostgresBinaryFileScan::PostgresBinaryFileScan(PhysicalPlan &physical_plan, const ReadPostgresBinaryBindData &bind_data,
+                                               vector<int32_t> field_lengths_p, idx_t estimated_cardinality)
+    : PhysicalOperator(physical_plan, PhysicalOperatorType::EXTENSION, {LogicalType::BLOB, LogicalType::BIGINT},
+                       estimated_cardinality),
+      files(bind_data.files), field_lengths(std::move(field_lengths_p)), split_size(bind_data.split_size) {
+}
+
+//===--------------------------------------------------------------------===//
+// States
+//===--------------------------------------------------------------------===//
+class PostgresBinaryFileScanGlobalState : public GlobalSourceState {
+public:
+	vector<ReadPostgresBinaryTask> tasks;
+	atomic<idx_t> next_task {0};
+
+	idx_t MaxThreads() override {
+		return MaxValue<idx_t>(tasks.size(), 1);
+	}
+};
+
+class PostgresBinaryFileScanLocalState : public LocalSourceState {
+public:
+	unique_ptr<PostgresBinaryFileReader> reader;
+};
+
+unique_ptr<GlobalSourceState> PostgresBinaryFileScan::GetGlobalSourceState(ClientContext &context) const {
+	auto result = make_uniq<PostgresBinaryFileScanGlobalState>();
+	result->tasks = PostgresBinaryFileReader::CreateTasks(context, files, split_size);
+	return std::move(result);
+}
+
+unique_ptr<LocalSourceState> PostgresBinaryFileScan::GetLocalSourceState(ExecutionContext &context,
+                                                                         GlobalSourceState &gstate) const {
+	return make_uniq<PostgresBinaryFileScanLocalState>();
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+SourceResultType PostgresBinaryFileScan::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                 OperatorSourceInput &input) const {
+	auto &gstate = input.global_state.Cast<PostgresBinaryFileScanGlobalState>();
+	auto &lstate = input.local_state.Cast<PostgresBinaryFileScanLocalState>();
+	while (true) {
+		if (!lstate.reader) {
+			auto task_idx = gstate.next_task++;
+			if (task_idx >= gstate.tasks.size()) {
+				return SourceResultType::FINISHED;
+			}
+			auto &task = gstate.tasks[task_idx];
+			lstate.reader = make_uniq<PostgresBinaryFileReader>(context.client, files[task.file_idx], task,
+			                                                    field_lengths);
+		}
+		if (!lstate.reader->Finished()) {
+			auto tuple_count = lstate.reader->ReadRaw(chunk.data[0], 0, BATCH_SIZE);
+			if (tuple_count > 0) {
+				FlatVector::GetData<int64_t>(chunk.data[1])[0] = NumericCast<int64_t>(tuple_count);
+				chunk.SetCardinality(1);
+				return SourceResultType::HAVE_MORE_OUTPUT;
+			}
+		}
+		lstate.reader.reset();
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Helpers
+//===--------------------------------------------------------------------===//
+string PostgresBinaryFileScan::GetName() const {
+	return "PG_BINARY_FILE_SCAN";
+}
+
+InsertionOrderPreservingMap<string> PostgresBinaryFileScan::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Files"] = StringUtil::Join(files, "\n");
+	return result;
+}
+
+} // namespace duckdb
@@ -10,39 +10,33 @@
 
 namespace duckdb {
 
+static idx_t GetConnectionLimit(DatabaseInstance &db) {
+	Value connection_limit;
+	if (db.TryGetCurrentSetting("pg_connection_limit", connection_limit)) {
+		return UBigIntValue::Get(connection_limit);
+	}
+	return PostgresConnectionPool::DEFAULT_MAX_CONNECTIONS;
+}
+
 PostgresCatalog::PostgresCatalog(AttachedDatabase &db_p, string connection_string_p, string attach_path_p,
-                                 AccessMode access_mode, string schema_to_load, PostgresIsolationLevel isolation_level)
+                                 AccessMode access_mode, string schema_to_load, PostgresIsolationLevel isolation_level,
+                                 idx_t min_connections)
     : Catalog(db_p), connection_string(std::move(connection_string_p)), attach_path(std::move(attach_path_p)),
-      access_mode(access_mode), isolation_level(isolation_level), schemas(*this, schema_to_load),
-      connection_pool(*this), default_schema(schema_to_load) {
+      access_mode(access_mode), isolation_level(isolation_level), min_connections(min_connections),
+      schemas(*this, schema_to_load),
+      connection_pool(PostgresConnectionPool::GetPool(connection_string, GetConnectionLimit(db_p.GetDatabase()))),
+      default_schema(schema_to_load) {
 	if (default_schema.empty()) {
 		default_schema = "public";
 	}
-	Value connection_limit;
-	auto &db_instance = db_p.GetDatabase();
-	if (db_instance.TryGetCurrentSetting("pg_connection_limit", connection_limit)) {
-		connection_pool.SetMaximumConnections(UBigIntValue::Get(connection_limit));
-	}
+	// open the initial set of connections concurrently - the version check below then uses one of them
+	connection_pool->RequestMinimumConnections(min_connections);
+	connection_pool->WarmUp(MaxValue<idx_t>(min_connections, 1));
 
-	auto connection = connection_pool.GetConnection();
+	auto connection = connection_pool->GetConnection();
 	this->version = connection.GetConnection().GetPostgresVersion();
 }
 
-string EscapeConnectionString(const string &input) {
-	string result = "'";
-	for (auto c : input) {
-		if (c == '\\') {
-			result += "\\\\";
-		} else if (c == '\'') {
-			result += "\\'";
-		} else {
-			result += c;
-		}
-	}
-	result += "'";
-	return result;
-}
-
 string AddConnectionOption(const KeyValueSecret &kv_secret, const string &name) {
 	Value input_val = kv_secret.TryGetValue(name);
 	if (input_val.IsNull()) {
@@ -52,7 +46,7 @@ string AddConnectionOption(const KeyValueSecret &kv_secret, const string &name)
 	string result;
 	result += name;
 	result += "=";
-	result += EscapeConnectionString(input_val.ToString());
+	result += PostgresUtils::EscapeConnectionString(input_val.ToString());
 	result += " ";
 	return result;
 }
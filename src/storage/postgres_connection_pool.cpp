@@ -1,8 +1,17 @@
 #include "storage/postgres_connection_pool.hpp"
-#include "storage/postgres_catalog.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
 static bool pg_use_connection_cache = true;
+static atomic<idx_t> pg_connection_idle_timeout {PostgresConnectionPool::DEFAULT_IDLE_TIMEOUT};
+static atomic<idx_t> pg_connection_health_check_interval {PostgresConnectionPool::DEFAULT_HEALTH_CHECK_INTERVAL};
+static atomic<idx_t> pg_connection_keepalive_idle {0};
+
+//! The process-wide registry of connection pools, keyed by normalized connection string
+static mutex pool_registry_lock;
+static unordered_map<string, weak_ptr<PostgresConnectionPool>> pool_registry;
 
 PostgresPoolConnection::PostgresPoolConnection() : pool(nullptr) {
 }
@@ -40,37 +49,349 @@ PostgresConnection &PostgresPoolConnection::GetConnection() {
 	return connection;
 }
 
-PostgresConnectionPool::PostgresConnectionPool(PostgresCatalog &postgres_catalog, idx_t maximum_connections_p)
-    : postgres_catalog(postgres_catalog), active_connections(0), maximum_connections(maximum_connections_p) {
+PostgresCachedConnection::PostgresCachedConnection(PostgresConnection connection_p)
+    : connection(std::move(connection_p)), last_used(std::chrono::steady_clock::now()), last_checked(last_used) {
+}
+
+PostgresConnectionPool::PostgresConnectionPool(string connection_string_p, idx_t maximum_connections_p)
+    : connection_string(std::move(connection_string_p)), active_connections(0), maximum_connections(maximum_connections_p),
+      minimum_connections(0), shutdown(false), connections_created(0), connections_reset(0), connection_failures(0),
+      connection_requests(0), total_wait_time(0) {
+	for (auto &bucket : wait_histogram) {
+		bucket = 0;
+	}
+	maintenance_thread = thread([this]() { MaintenanceLoop(); });
+}
+
+PostgresConnectionPool::~PostgresConnectionPool() {
+	{
+		lock_guard<mutex> l(connection_lock);
+		shutdown = true;
+	}
+	maintenance_cv.notify_all();
+	if (maintenance_thread.joinable()) {
+		maintenance_thread.join();
+	}
+}
+
+string PostgresConnectionPool::NormalizeConnectionString(const string &connection_string, bool include_password) {
+	char *error_message = nullptr;
+	auto options = PQconninfoParse(connection_string.c_str(), &error_message);
+	if (!options) {
+		// not a valid connection string - connecting will report the error, we just use it as-is
+		if (error_message) {
+			PQfreemem(error_message);
+		}
+		return connection_string;
+	}
+	// libpq returns the options in a fixed order - so equivalent connection strings produce the same result
+	string result;
+	for (auto option = options; option->keyword; option++) {
+		if (!option->val || !option->val[0]) {
+			continue;
+		}
+		if (!include_password && strcmp(option->keyword, "password") == 0) {
+			continue;
+		}
+		if (!result.empty()) {
+			result += " ";
+		}
+		result += string(option->keyword) + "=" + PostgresUtils::EscapeConnectionString(option->val);
+	}
+	PQconninfoFree(options);
+	return result;
+}
+
+shared_ptr<PostgresConnectionPool> PostgresConnectionPool::GetPool(const string &connection_string,
+                                                                   idx_t maximum_connections) {
+	auto key = NormalizeConnectionString(connection_string);
+	lock_guard<mutex> l(pool_registry_lock);
+	// clean up pools that are no longer in use
+	for (auto it = pool_registry.begin(); it != pool_registry.end();) {
+		if (it->second.expired()) {
+			it = pool_registry.erase(it);
+		} else {
+			it++;
+		}
+	}
+	auto entry = pool_registry.find(key);
+	if (entry != pool_registry.end()) {
+		auto pool = entry->second.lock();
+		if (pool) {
+			// the pool is shared - a user asking for fewer connections must not restrict the other users
+			pool->RequestMaximumConnections(maximum_connections);
+			return pool;
+		}
+	}
+	auto pool = make_shared_ptr<PostgresConnectionPool>(connection_string, maximum_connections);
+	pool_registry[key] = pool;
+	return pool;
 }
 
-PostgresPoolConnection PostgresConnectionPool::GetConnectionInternal() {
+vector<shared_ptr<PostgresConnectionPool>> PostgresConnectionPool::GetPools() {
+	vector<shared_ptr<PostgresConnectionPool>> result;
+	lock_guard<mutex> l(pool_registry_lock);
+	for (auto &entry : pool_registry) {
+		auto pool = entry.second.lock();
+		if (pool) {
+			result.push_back(std::move(pool));
+		}
+	}
+	return result;
+}
+
+string PostgresConnectionPool::GetDisplayConnectionString() {
+	return NormalizeConnectionString(connection_string, false);
+}
+
+string PostgresConnectionPool::GetConnectionString() {
+	idx_t keepalive_idle = pg_connection_keepalive_idle;
+	if (keepalive_idle == 0) {
+		return connection_string;
+	}
+	// probe idle sockets so that dead peers and middleboxes dropping idle connections are detected early
+	auto keepalive_interval = MaxValue<idx_t>(keepalive_idle / 3, 1);
+	if (StringUtil::StartsWith(connection_string, "postgres://") ||
+	    StringUtil::StartsWith(connection_string, "postgresql://")) {
+		auto separator = connection_string.find('?') == string::npos ? "?" : "&";
+		return connection_string + separator +
+		       StringUtil::Format("keepalives=1&keepalives_idle=%llu&keepalives_interval=%llu&keepalives_count=3",
+		                          keepalive_idle, keepalive_interval);
+	}
+	return connection_string +
+	       StringUtil::Format(" keepalives=1 keepalives_idle=%llu keepalives_interval=%llu keepalives_count=3",
+	                          keepalive_idle, keepalive_interval);
+}
+
+PostgresPoolConnection PostgresConnectionPool::GetConnectionInternal(unique_lock<mutex> &lock) {
 	active_connections++;
 	// check if we have any cached connections left
 	if (!connection_cache.empty()) {
-		auto connection = PostgresPoolConnection(this, std::move(connection_cache.back()));
+		auto connection = PostgresPoolConnection(this, std::move(connection_cache.back().connection));
 		connection_cache.pop_back();
 		return connection;
 	}
 
 	// no cached connections left but there is space to open a new one - open it
-	return PostgresPoolConnection(this, PostgresConnection::Open(postgres_catalog.connection_string));
+	// we release the lock while connecting so that concurrent connection attempts are not serialized
+	lock.unlock();
+	try {
+		auto connection = PostgresPoolConnection(this, PostgresConnection::Open(GetConnectionString()));
+		connections_created++;
+		return connection;
+	} catch (...) {
+		connection_failures++;
+		lock.lock();
+		active_connections--;
+		throw;
+	}
+}
+
+void PostgresConnectionPool::RecordWait(std::chrono::steady_clock::time_point start) {
+	auto elapsed = std::chrono::steady_clock::now() - start;
+	auto wait_time = NumericCast<idx_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+	idx_t bucket = 0;
+	while (bucket + 1 < WAIT_HISTOGRAM_BUCKETS && (idx_t(1) << bucket) <= wait_time) {
+		bucket++;
+	}
+	connection_requests++;
+	total_wait_time += wait_time;
+	wait_histogram[bucket]++;
 }
 
 PostgresPoolConnection PostgresConnectionPool::ForceGetConnection() {
-	lock_guard<mutex> l(connection_lock);
-	return GetConnectionInternal();
+	auto start = std::chrono::steady_clock::now();
+	unique_lock<mutex> l(connection_lock);
+	auto connection = GetConnectionInternal(l);
+	RecordWait(start);
+	return connection;
 }
 
 bool PostgresConnectionPool::TryGetConnection(PostgresPoolConnection &connection) {
-	lock_guard<mutex> l(connection_lock);
+	auto start = std::chrono::steady_clock::now();
+	unique_lock<mutex> l(connection_lock);
 	if (active_connections >= maximum_connections) {
 		return false;
 	}
-	connection = GetConnectionInternal();
+	connection = GetConnectionInternal(l);
+	RecordWait(start);
 	return true;
 }
 
+void PostgresConnectionPool::WarmUp(idx_t count) {
+	idx_t open_count;
+	{
+		lock_guard<mutex> l(connection_lock);
+		if (!pg_use_connection_cache || connection_cache.size() >= count) {
+			return;
+		}
+		auto total_open_connections = active_connections + connection_cache.size();
+		if (total_open_connections >= maximum_connections) {
+			return;
+		}
+		open_count = MinValue<idx_t>(count - connection_cache.size(), maximum_connections - total_open_connections);
+		// reserve the connection slots while we are connecting
+		active_connections += open_count;
+	}
+	vector<PostgresConnection> connections;
+	try {
+		connections = PostgresConnection::OpenParallel(GetConnectionString(), open_count);
+		connections_created += open_count;
+	} catch (...) {
+		connection_failures++;
+		lock_guard<mutex> l(connection_lock);
+		active_connections -= open_count;
+		throw;
+	}
+	lock_guard<mutex> l(connection_lock);
+	active_connections -= open_count;
+	for (auto &connection : connections) {
+		connection_cache.emplace_back(std::move(connection));
+	}
+}
+
+void PostgresConnectionPool::RequestMinimumConnections(idx_t new_min) {
+	lock_guard<mutex> l(connection_lock);
+	minimum_connections = MaxValue<idx_t>(minimum_connections, new_min);
+}
+
+PostgresConnectionPoolStatistics PostgresConnectionPool::GetStatistics() {
+	PostgresConnectionPoolStatistics result;
+	{
+		lock_guard<mutex> l(connection_lock);
+		result.active_connections = active_connections;
+		result.idle_connections = connection_cache.size();
+		result.maximum_connections = maximum_connections;
+	}
+	result.connections_created = connections_created;
+	result.connections_reset = connections_reset;
+	result.connection_failures = connection_failures;
+	result.connection_requests = connection_requests;
+	result.total_wait_time = total_wait_time;
+	// find the histogram bucket that contains the 99th percentile and report its upper bound
+	idx_t total_count = 0;
+	idx_t bucket_counts[WAIT_HISTOGRAM_BUCKETS];
+	for (idx_t i = 0; i < WAIT_HISTOGRAM_BUCKETS; i++) {
+		bucket_counts[i] = wait_histogram[i];
+		total_count += bucket_counts[i];
+	}
+	idx_t threshold = total_count - total_count / 100;
+	idx_t running_count = 0;
+	for (idx_t i = 0; i < WAIT_HISTOGRAM_BUCKETS && total_count > 0; i++) {
+		running_count += bucket_counts[i];
+		if (running_count >= threshold) {
+			result.p99_wait_time = idx_t(1) << i;
+			break;
+		}
+	}
+	return result;
+}
+
+void PostgresConnectionPool::MaintenanceLoop() {
+	auto last_run = std::chrono::steady_clock::now();
+	unique_lock<mutex> l(connection_lock);
+	while (!shutdown) {
+		// wake up regularly so that changes to the health check interval are picked up
+		maintenance_cv.wait_for(l, std::chrono::seconds(1));
+		if (shutdown) {
+			break;
+		}
+		idx_t interval = pg_connection_health_check_interval;
+		auto now = std::chrono::steady_clock::now();
+		if (interval == 0 || now - last_run < std::chrono::seconds(interval)) {
+			continue;
+		}
+		last_run = now;
+		l.unlock();
+		try {
+			RunMaintenance();
+		} catch (...) {
+			// failing to reconnect (e.g. because the server is unreachable) is not fatal - we retry in the next round
+		}
+		l.lock();
+	}
+}
+
+void PostgresConnectionPool::RunMaintenance() {
+	auto now = std::chrono::steady_clock::now();
+	auto idle_timeout = std::chrono::seconds(pg_connection_idle_timeout.load());
+	auto check_interval = std::chrono::seconds(pg_connection_health_check_interval.load());
+	// connections are closed and probed outside of the lock so that they never block the query path
+	vector<PostgresCachedConnection> expired_connections;
+	vector<PostgresCachedConnection> check_connections;
+	idx_t target_connections;
+	{
+		lock_guard<mutex> l(connection_lock);
+		if (!pg_use_connection_cache) {
+			return;
+		}
+		// connections are handed out from the back of the cache - the front holds the least recently used ones
+		vector<PostgresCachedConnection> remaining_connections;
+		for (auto &entry : connection_cache) {
+			auto cached_count = connection_cache.size() - expired_connections.size();
+			if (idle_timeout.count() > 0 && now - entry.last_used >= idle_timeout &&
+			    cached_count > minimum_connections) {
+				expired_connections.push_back(std::move(entry));
+			} else if (now - entry.last_checked >= check_interval) {
+				check_connections.push_back(std::move(entry));
+			} else {
+				remaining_connections.push_back(std::move(entry));
+			}
+		}
+		connection_cache = std::move(remaining_connections);
+		// the connections we are checking still occupy a connection slot
+		active_connections += check_connections.size();
+		target_connections = minimum_connections;
+	}
+	vector<PostgresCachedConnection> alive_connections;
+	for (auto &entry : check_connections) {
+		if (!entry.connection.Ping()) {
+			if (!entry.connection.Reset()) {
+				// the connection is dead and could not be re-established - drop it
+				connection_failures++;
+				continue;
+			}
+			connections_reset++;
+		}
+		entry.last_checked = std::chrono::steady_clock::now();
+		alive_connections.push_back(std::move(entry));
+	}
+	{
+		lock_guard<mutex> l(connection_lock);
+		active_connections -= check_connections.size();
+		for (auto &entry : alive_connections) {
+			if (active_connections + connection_cache.size() >= maximum_connections) {
+				break;
+			}
+			connection_cache.insert(connection_cache.begin(), std::move(entry));
+		}
+	}
+	// replace any connections we have dropped so that the pool stays warm
+	WarmUp(target_connections);
+}
+
+void PostgresConnectionPool::PostgresSetIdleTimeout(ClientContext &context, SetScope scope, Value &parameter) {
+	if (parameter.IsNull()) {
+		throw BinderException("Cannot be set to NULL");
+	}
+	pg_connection_idle_timeout = UBigIntValue::Get(parameter);
+}
+
+void PostgresConnectionPool::PostgresSetHealthCheckInterval(ClientContext &context, SetScope scope,
+                                                            Value &parameter) {
+	if (parameter.IsNull()) {
+		throw BinderException("Cannot be set to NULL");
+	}
+	pg_connection_health_check_interval = UBigIntValue::Get(parameter);
+}
+
+void PostgresConnectionPool::PostgresSetKeepAliveIdle(ClientContext &context, SetScope scope, Value &parameter) {
+	if (parameter.IsNull()) {
+		throw BinderException("Cannot be set to NULL");
+	}
+	pg_connection_keepalive_idle = UBigIntValue::Get(parameter);
+}
+
 void PostgresConnectionPool::PostgresSetConnectionCache(ClientContext &context, SetScope scope, Value &parameter) {
 	if (parameter.IsNull()) {
 		throw BinderException("Cannot be set to NULL");
@@ -103,19 +424,16 @@ void PostgresConnectionPool::ReturnConnection(PostgresConnection connection) {
 		return;
 	}
 	// check if the underlying connection is still usable
+	// we never reconnect here as that would block the query returning the connection
+	// dropped connections are replaced by the background maintenance instead
 	auto pg_con = connection.GetConn();
-	if (PQstatus(connection.GetConn()) != CONNECTION_OK) {
-		// CONNECTION_BAD! try to reset it
-		PQreset(pg_con);
-		if (PQstatus(connection.GetConn()) != CONNECTION_OK) {
-			// still bad - just abandon this one
-			return;
-		}
+	if (PQstatus(pg_con) != CONNECTION_OK) {
+		return;
 	}
 	if (PQtransactionStatus(pg_con) != PQTRANS_IDLE) {
 		return;
 	}
-	connection_cache.push_back(std::move(connection));
+	connection_cache.emplace_back(std::move(connection));
 }
 
 void PostgresConnectionPool::SetMaximumConnections(idx_t new_max) {
@@ -133,4 +451,9 @@ void PostgresConnectionPool::SetMaximumConnections(idx_t new_max) {
 	maximum_connections = new_max;
 }
 
+void PostgresConnectionPool::RequestMaximumConnections(idx_t new_max) {
+	lock_guard<mutex> l(connection_lock);
+	maximum_connections = MaxValue<idx_t>(maximum_connections, new_max);
+}
+
 } // namespace duckdb
@@ -2,8 +2,11 @@
 #include "storage/postgres_table_entry.hpp"
 #include "duckdb/planner/operator/logical_delete.hpp"
 #include "storage/postgres_catalog.hpp"
+#include "storage/postgres_dml_pushdown.hpp"
 #include "storage/postgres_transaction.hpp"
 #include "postgres_connection.hpp"
+#include "postgres_binary_writer.hpp"
+#include "duckdb/common/types/uuid.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 namespace duckdb {
@@ -17,12 +20,42 @@ PostgresDelete::PostgresDelete(PhysicalPlan &physical_plan, LogicalOperator &op,
 //===--------------------------------------------------------------------===//
 // States
 //===--------------------------------------------------------------------===//
-string GetDeleteSQL(const PostgresTableEntry &table, const string &ctid_list) {
+string GetDeleteSQL(const PostgresTableEntry &table, const string &ctid_condition) {
 	string result;
 	result = "DELETE FROM ";
 	result += KeywordHelper::WriteQuoted(table.schema.name, '"') + ".";
 	result += PostgresUtils::QuotePostgresIdentifier(table.name);
-	result += " WHERE ctid IN (" + ctid_list + ")";
+	result += " WHERE ctid = ANY(" + ctid_condition + ")";
+	return result;
+}
+
+static string GetDeleteUsingSQL(const PostgresTableEntry &table, const string &delete_table) {
+	// joining against the staged row ids lets Postgres plan the delete as a join
+	// an array of all row ids would have to be materialized in the backend and is limited in size
+	auto table_name = KeywordHelper::WriteQuoted(table.schema.name, '"') + "." +
+	                  PostgresUtils::QuotePostgresIdentifier(table.name);
+	string result;
+	result = "DELETE FROM " + table_name + " USING " + delete_table;
+	result += " WHERE " + table_name + ".ctid = " + delete_table + ".__ctid";
+	return result;
+}
+
+string GetCTIDArrayLiteral(const vector<row_t> &row_ids) {
+	string result = "'{";
+	for (idx_t i = 0; i < row_ids.size(); i++) {
+		if (i > 0) {
+			result += ",";
+		}
+		// extract the ctid from the row id
+		auto row_in_page = row_ids[i] & 0xFFFF;
+		auto page_index = row_ids[i] >> 16;
+		result += "\"(";
+		result += to_string(page_index);
+		result += ",";
+		result += to_string(row_in_page);
+		result += ")\"";
+	}
+	result += "}'::TID[]";
 	return result;
 }
 
@@ -32,23 +65,62 @@ public:
 	}
 
 	PostgresTableEntry &table;
-	string ctid_list;
+	//! Row ids that have not been sent to Postgres yet
+	vector<row_t> row_ids;
+	//! The temporary table the row ids are streamed into when deleting many rows
+	string delete_table_name;
+	PostgresCopyState copy_state;
+	bool copy_is_active = false;
 	idx_t delete_count;
 
+	//! Streams the buffered row ids into the temporary table using a binary COPY
+	void StageRowIds(ClientContext &context) {
+		auto &transaction = PostgresTransaction::Get(context, table.catalog);
+		auto &connection = transaction.GetConnection();
+		if (!copy_is_active) {
+			delete_table_name = "delete_data_" + UUID::ToString(UUID::GenerateRandomUUID());
+			auto delete_table = PostgresUtils::QuotePostgresIdentifier(delete_table_name);
+			connection.Execute("CREATE LOCAL TEMPORARY TABLE " + delete_table + "(__ctid TID) ON COMMIT DROP");
+			string schema_name;
+			vector<string> column_names;
+			connection.BeginCopyTo(context, copy_state, PostgresCopyFormat::BINARY, schema_name, delete_table_name,
+			                       column_names);
+			copy_is_active = true;
+		}
+		PostgresBinaryWriter writer(copy_state);
+		for (auto row_id : row_ids) {
+			writer.BeginRow(1);
+			writer.WriteCTID(row_id);
+			writer.FinishRow();
+		}
+		connection.CopyData(writer);
+		row_ids.clear();
+	}
+
 	void Flush(ClientContext &context) {
-		if (ctid_list.empty()) {
+		auto &transaction = PostgresTransaction::Get(context, table.catalog);
+		if (copy_is_active) {
+			// finish streaming the row ids and delete all of them in one statement
+			StageRowIds(context);
+			auto &connection = transaction.GetConnection();
+			connection.FinishCopyTo(copy_state);
+			copy_is_active = false;
+			auto delete_table = PostgresUtils::QuotePostgresIdentifier(delete_table_name);
+			transaction.Query(GetDeleteUsingSQL(table, delete_table));
+			transaction.Query("DROP TABLE " + delete_table);
 			return;
 		}
-		auto &transaction = PostgresTransaction::Get(context, table.catalog);
-		transaction.Query(GetDeleteSQL(table, ctid_list));
-		ctid_list = "";
+		if (row_ids.empty()) {
+			return;
+		}
+		// few rows - send them as a single array literal
+		transaction.Query(GetDeleteSQL(table, GetCTIDArrayLiteral(row_ids)));
+		row_ids.clear();
 	}
 };
 
 unique_ptr<GlobalSinkState> PostgresDelete::GetGlobalSinkState(ClientContext &context) const {
 	auto &postgres_table = table.Cast<PostgresTableEntry>();
-
-	auto &transaction = PostgresTransaction::Get(context, postgres_table.catalog);
 	auto result = make_uniq<PostgresDeleteGlobalState>(postgres_table);
 	return std::move(result);
 }
@@ -62,22 +134,10 @@ SinkResultType PostgresDelete::Sink(ExecutionContext &context, DataChunk &chunk,
 	chunk.Flatten();
 	auto &row_identifiers = chunk.data[row_id_index];
 	auto row_data = FlatVector::GetData<row_t>(row_identifiers);
-	for (idx_t i = 0; i < chunk.size(); i++) {
-		if (!gstate.ctid_list.empty()) {
-			gstate.ctid_list += ",";
-		}
-		// extract the ctid from the row id
-		auto row_in_page = row_data[i] & 0xFFFF;
-		auto page_index = row_data[i] >> 16;
-		gstate.ctid_list += "'(";
-		gstate.ctid_list += to_string(page_index);
-		gstate.ctid_list += ",";
-		gstate.ctid_list += to_string(row_in_page);
-		gstate.ctid_list += ")'";
-		if (gstate.ctid_list.size() > 3000) {
-			// avoid making too long SQL statements
-			gstate.Flush(context.client);
-		}
+	gstate.row_ids.insert(gstate.row_ids.end(), row_data, row_data + chunk.size());
+	if (gstate.row_ids.size() >= DELETE_BATCH_SIZE) {
+		// many rows are deleted - stream the row ids into a temporary table instead of sending them as literals
+		gstate.StageRowIds(context.client);
 	}
 	gstate.delete_count += chunk.size();
 	return SinkResultType::NEED_MORE_INPUT;
@@ -126,6 +186,10 @@ PhysicalOperator &PostgresCatalog::PlanDelete(ClientContext &context, PhysicalPl
 	if (op.return_chunk) {
 		throw BinderException("RETURNING clause not yet supported for deletion of a Postgres table");
 	}
+	auto remote_delete = PostgresDMLPushdown::TryPlanDelete(context, planner, op);
+	if (remote_delete) {
+		return *remote_delete;
+	}
 	auto &bound_ref = op.expressions[0]->Cast<BoundReferenceExpression>();
 	PostgresCatalog::MaterializePostgresScans(plan);
 
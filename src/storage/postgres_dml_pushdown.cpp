@@ -0,0 +1,766 @@
+#include "storage/postgres_dml_pushdown.hpp"
+#include "storage/postgres_catalog.hpp"
+#include "storage/postgres_schema_entry.hpp"
+#include "storage/postgres_table_entry.hpp"
+#include "storage/postgres_transaction.hpp"
+#include "postgres_filter_pushdown.hpp"
+#include "postgres_scanner.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/planner/expression/list.hpp"
+#include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
+#include "duckdb/planner/operator/logical_create_table.hpp"
+#include "duckdb/planner/operator/logical_delete.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_insert.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_update.hpp"
+
+namespace duckdb {
+
+PostgresRemoteDML::PostgresRemoteDML(PhysicalPlan &physical_plan, vector<LogicalType> types, PostgresCatalog &catalog,
+                                     string name, string table_name, string sql)
+    : PhysicalOperator(physical_plan, PhysicalOperatorType::EXTENSION, std::move(types), 1), catalog(catalog),
+      name(std::move(name)), table_name(std::move(table_name)), sql(std::move(sql)) {
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+SourceResultType PostgresRemoteDML::GetData(ExecutionContext &context, DataChunk &chunk,
+                                            OperatorSourceInput &input) const {
+	chunk.SetCardinality(1);
+	if (info && !schema->CreateTable(schema->GetCatalogTransaction(context.client), *info)) {
+		// CREATE TABLE IF NOT EXISTS ... AS on an existing table - nothing is inserted
+		chunk.SetValue(0, 0, Value::BIGINT(0));
+		return SourceResultType::FINISHED;
+	}
+	auto &transaction = PostgresTransaction::Get(context.client, catalog);
+	auto result = transaction.Query(sql);
+	chunk.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(result->AffectedRows())));
+	return SourceResultType::FINISHED;
+}
+
+//===--------------------------------------------------------------------===//
+// Helpers
+//===--------------------------------------------------------------------===//
+string PostgresRemoteDML::GetName() const {
+	return name;
+}
+
+InsertionOrderPreservingMap<string> PostgresRemoteDML::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Table Name"] = table_name;
+	result["Statement"] = sql;
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Expression Translation
+//===--------------------------------------------------------------------===//
+static bool IsNumericType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Intervals are normalized differently by DuckDB and Postgres - arithmetic that produces an interval is not translated
+static bool IsArithmeticType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return true;
+	default:
+		return IsNumericType(type);
+	}
+}
+
+//! Adding days or months to a TIMESTAMP WITH TIME ZONE depends on the time zone of the session, which can differ
+//! between DuckDB and Postgres - only constant intervals that consist of a fixed amount of time are translated
+static bool IsFixedInterval(const Expression &expr) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_CONSTANT ||
+	    expr.return_type.id() != LogicalTypeId::INTERVAL) {
+		return false;
+	}
+	auto &value = expr.Cast<BoundConstantExpression>().value;
+	if (value.IsNull()) {
+		return false;
+	}
+	auto interval = IntervalValue::Get(value);
+	return interval.months == 0 && interval.days == 0;
+}
+
+//! Columns that are converted when they are read (e.g. inet that is read as VARCHAR) compare differently in Postgres
+static bool IsStandardType(const PostgresType &type) {
+	if (type.info != PostgresTypeAnnotation::STANDARD) {
+		return false;
+	}
+	for (auto &child : type.children) {
+		if (!IsStandardType(child)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static idx_t IntegerDigits(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::SMALLINT:
+		return 5;
+	case LogicalTypeId::INTEGER:
+		return 10;
+	case LogicalTypeId::BIGINT:
+		return 19;
+	default:
+		return 0;
+	}
+}
+
+//! Only casts that are lossless in both DuckDB and Postgres are translated - their results are guaranteed to be equal
+//! Casts that depend on e.g. the time zone or on rounding behavior are not translated
+static bool IsLosslessCast(const LogicalType &source, const LogicalType &target) {
+	auto source_digits = IntegerDigits(source);
+	if (source_digits > 0) {
+		auto target_digits = IntegerDigits(target);
+		if (target_digits >= source_digits || target.id() == LogicalTypeId::DOUBLE) {
+			return true;
+		}
+		if (target.id() == LogicalTypeId::DECIMAL) {
+			return idx_t(DecimalType::GetWidth(target) - DecimalType::GetScale(target)) >= source_digits;
+		}
+		return false;
+	}
+	if (source.id() == LogicalTypeId::FLOAT && target.id() == LogicalTypeId::DOUBLE) {
+		return true;
+	}
+	if (source.id() == LogicalTypeId::DATE && target.id() == LogicalTypeId::TIMESTAMP) {
+		return true;
+	}
+	return false;
+}
+
+static bool SupportsLiteral(const Value &value) {
+	auto &type = value.type();
+	if (type.HasAlias()) {
+		return false;
+	}
+	switch (type.id()) {
+	case LogicalTypeId::FLOAT:
+		return Value::IsFinite(FloatValue::Get(value));
+	case LogicalTypeId::DOUBLE:
+		return Value::IsFinite(DoubleValue::Get(value));
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::INTERVAL:
+	case LogicalTypeId::UUID:
+	case LogicalTypeId::BLOB:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool SupportsTableFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::IS_NULL:
+	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND:
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionFilter>();
+		for (auto &child : conjunction.child_filters) {
+			if (!SupportsTableFilter(*child)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Translates the predicates and expressions of a DML plan into Postgres SQL
+//! The plan must be a chain of projections and filters on top of a scan of a single table
+class PostgresDMLTransformer {
+public:
+	explicit PostgresDMLTransformer(PostgresTableEntry &table) : catalog(table.catalog), table(&table) {
+	}
+	//! Allows scans of any table in the catalog - the scanned table is stored in "table"
+	explicit PostgresDMLTransformer(Catalog &catalog) : catalog(catalog) {
+	}
+
+	Catalog &catalog;
+	//! The scanned table
+	optional_ptr<PostgresTableEntry> table;
+	//! The conditions that make up the WHERE clause
+	vector<string> conditions;
+	//! If set, column references are translated by position into these names instead of through the plan
+	vector<string> column_references;
+
+public:
+	//! Gathers the conditions of the plan - returns false if any part of the plan cannot be translated
+	bool TransformPlan(LogicalOperator &op) {
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION:
+			return TransformPlan(*op.children[0]);
+		case LogicalOperatorType::LOGICAL_FILTER: {
+			for (auto &expr : op.expressions) {
+				string condition;
+				if (!TransformExpression(*op.children[0], *expr, condition)) {
+					return false;
+				}
+				conditions.push_back(std::move(condition));
+			}
+			return TransformPlan(*op.children[0]);
+		}
+		case LogicalOperatorType::LOGICAL_GET:
+			return TransformGet(op.Cast<LogicalGet>());
+		default:
+			return false;
+		}
+	}
+
+	//! Translates an expression that is evaluated on top of the output of "child"
+	bool TransformExpression(LogicalOperator &child, Expression &expr, string &result) {
+		switch (expr.GetExpressionClass()) {
+		case ExpressionClass::BOUND_REF: {
+			auto index = expr.Cast<BoundReferenceExpression>().index;
+			if (!column_references.empty()) {
+				if (index >= column_references.size()) {
+					return false;
+				}
+				result = column_references[index];
+				return true;
+			}
+			return TransformColumn(child, index, result);
+		}
+		case ExpressionClass::BOUND_CONSTANT:
+			return TransformConstant(expr.Cast<BoundConstantExpression>().value, result);
+		case ExpressionClass::BOUND_COMPARISON: {
+			auto &comparison = expr.Cast<BoundComparisonExpression>();
+			string op, left, right;
+			if (!TransformComparison(expr.GetExpressionType(), op) ||
+			    !TransformExpression(child, *comparison.left, left) ||
+			    !TransformExpression(child, *comparison.right, right)) {
+				return false;
+			}
+			result = "(" + left + " " + op + " " + right + ")";
+			return true;
+		}
+		case ExpressionClass::BOUND_CONJUNCTION: {
+			auto &conjunction = expr.Cast<BoundConjunctionExpression>();
+			auto op = expr.GetExpressionType() == ExpressionType::CONJUNCTION_AND ? " AND " : " OR ";
+			vector<string> children;
+			if (!TransformChildren(child, conjunction.children, children)) {
+				return false;
+			}
+			result = "(" + StringUtil::Join(children, op) + ")";
+			return true;
+		}
+		case ExpressionClass::BOUND_OPERATOR:
+			return TransformOperator(child, expr.Cast<BoundOperatorExpression>(), result);
+		case ExpressionClass::BOUND_BETWEEN: {
+			auto &between = expr.Cast<BoundBetweenExpression>();
+			string input, lower, upper;
+			if (!TransformExpression(child, *between.input, input) ||
+			    !TransformExpression(child, *between.lower, lower) ||
+			    !TransformExpression(child, *between.upper, upper)) {
+				return false;
+			}
+			result = "(" + input + (between.lower_inclusive ? " >= " : " > ") + lower + " AND " + input +
+			         (between.upper_inclusive ? " <= " : " < ") + upper + ")";
+			return true;
+		}
+		case ExpressionClass::BOUND_FUNCTION:
+			return TransformFunction(child, expr.Cast<BoundFunctionExpression>(), result);
+		case ExpressionClass::BOUND_CAST: {
+			auto &cast = expr.Cast<BoundCastExpression>();
+			if (cast.try_cast || !IsLosslessCast(cast.child->return_type, cast.return_type)) {
+				return false;
+			}
+			string child_str;
+			if (!TransformExpression(child, *cast.child, child_str)) {
+				return false;
+			}
+			result = "CAST(" + child_str + " AS " + PostgresUtils::TypeToString(cast.return_type) + ")";
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	//! Translates the column at position "index" of the output of "op"
+	bool TransformColumn(LogicalOperator &op, idx_t index, string &result) {
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION:
+			if (index >= op.expressions.size()) {
+				return false;
+			}
+			return TransformExpression(*op.children[0], *op.expressions[index], result);
+		case LogicalOperatorType::LOGICAL_FILTER: {
+			auto &filter = op.Cast<LogicalFilter>();
+			if (!filter.projection_map.empty()) {
+				index = filter.projection_map[index];
+			}
+			return TransformColumn(*op.children[0], index, result);
+		}
+		case LogicalOperatorType::LOGICAL_GET: {
+			auto &get = op.Cast<LogicalGet>();
+			auto &bind_data = get.bind_data->Cast<PostgresBindData>();
+			auto column_index = get.projection_ids.empty() ? index : get.projection_ids[index];
+			auto column_id = get.GetColumnIds()[column_index].GetPrimaryIndex();
+			if (IsVirtualColumn(column_id) || !IsStandardType(bind_data.postgres_types[column_id])) {
+				return false;
+			}
+			result = KeywordHelper::WriteQuoted(bind_data.names[column_id], '"');
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+private:
+	bool TransformGet(LogicalGet &get) {
+		if (!PostgresCatalog::IsPostgresScan(get.function.name)) {
+			return false;
+		}
+		auto &bind_data = get.bind_data->Cast<PostgresBindData>();
+		auto pg_table = bind_data.GetTable();
+		if (!pg_table || !bind_data.sql.empty() || !bind_data.limit.empty()) {
+			return false;
+		}
+		if (!table) {
+			if (&pg_table->catalog != &catalog) {
+				return false;
+			}
+			table = pg_table;
+		} else if (pg_table.get() != table.get()) {
+			return false;
+		}
+		vector<column_t> column_ids;
+		for (auto &column_id : get.GetColumnIds()) {
+			column_ids.push_back(column_id.GetPrimaryIndex());
+		}
+		for (auto &entry : get.table_filters.filters) {
+			auto column_id = column_ids[entry.first];
+			if (IsVirtualColumn(column_id) || !IsStandardType(bind_data.postgres_types[column_id]) ||
+			    !SupportsTableFilter(*entry.second)) {
+				return false;
+			}
+		}
+		auto filter = PostgresFilterPushdown::TransformFilters(column_ids, &get.table_filters, bind_data.names);
+		if (!filter.empty()) {
+			conditions.push_back(std::move(filter));
+		}
+		return true;
+	}
+
+	bool TransformChildren(LogicalOperator &child, vector<unique_ptr<Expression>> &expressions,
+	                       vector<string> &result) {
+		for (auto &expr : expressions) {
+			string child_str;
+			if (!TransformExpression(child, *expr, child_str)) {
+				return false;
+			}
+			result.push_back(std::move(child_str));
+		}
+		return true;
+	}
+
+	static bool TransformConstant(const Value &value, string &result) {
+		if (value.IsNull()) {
+			result = "NULL";
+			return true;
+		}
+		if (!SupportsLiteral(value)) {
+			return false;
+		}
+		result = PostgresFilterPushdown::TransformLiteral(value);
+		if (value.type().id() != LogicalTypeId::BLOB) {
+			result += "::" + PostgresUtils::TypeToString(value.type());
+		}
+		return true;
+	}
+
+	static bool TransformComparison(ExpressionType type, string &result) {
+		switch (type) {
+		case ExpressionType::COMPARE_EQUAL:
+			result = "=";
+			return true;
+		case ExpressionType::COMPARE_NOTEQUAL:
+			result = "<>";
+			return true;
+		case ExpressionType::COMPARE_LESSTHAN:
+			result = "<";
+			return true;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			result = ">";
+			return true;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			result = "<=";
+			return true;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			result = ">=";
+			return true;
+		case ExpressionType::COMPARE_DISTINCT_FROM:
+			result = "IS DISTINCT FROM";
+			return true;
+		case ExpressionType::COMPARE_NOT_DISTINCT_FROM:
+			result = "IS NOT DISTINCT FROM";
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool TransformOperator(LogicalOperator &child, BoundOperatorExpression &op, string &result) {
+		vector<string> children;
+		if (!TransformChildren(child, op.children, children)) {
+			return false;
+		}
+		switch (op.GetExpressionType()) {
+		case ExpressionType::OPERATOR_NOT:
+			result = "(NOT " + children[0] + ")";
+			return true;
+		case ExpressionType::OPERATOR_IS_NULL:
+			result = "(" + children[0] + " IS NULL)";
+			return true;
+		case ExpressionType::OPERATOR_IS_NOT_NULL:
+			result = "(" + children[0] + " IS NOT NULL)";
+			return true;
+		case ExpressionType::COMPARE_IN:
+		case ExpressionType::COMPARE_NOT_IN: {
+			auto input = std::move(children[0]);
+			children.erase(children.begin());
+			auto op_str = op.GetExpressionType() == ExpressionType::COMPARE_IN ? " IN (" : " NOT IN (";
+			result = "(" + input + op_str + StringUtil::Join(children, ", ") + "))";
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	bool TransformFunction(LogicalOperator &child, BoundFunctionExpression &func, string &result) {
+		auto &name = func.function.name;
+		if (func.children.empty()) {
+			// functions such as now() refer to the transaction in DuckDB, which started at a different time
+			return false;
+		}
+		vector<string> children;
+		if (!TransformChildren(child, func.children, children)) {
+			return false;
+		}
+		if (children.size() == 1) {
+			if (name == "-" && IsNumericType(func.return_type)) {
+				result = "(-" + children[0] + ")";
+				return true;
+			}
+			return false;
+		}
+		if (children.size() != 2) {
+			return false;
+		}
+		if (name == "+" || name == "-" || name == "*") {
+			if (!IsArithmeticType(func.return_type)) {
+				return false;
+			}
+			if (func.return_type.id() == LogicalTypeId::TIMESTAMP_TZ) {
+				auto &interval = func.children[0]->return_type.id() == LogicalTypeId::INTERVAL ? *func.children[0]
+				                                                                               : *func.children[1];
+				if (!IsFixedInterval(interval)) {
+					return false;
+				}
+			}
+		} else if (name == "%") {
+			if (IntegerDigits(func.return_type) == 0) {
+				return false;
+			}
+		} else if (name == "||") {
+			if (func.return_type.id() != LogicalTypeId::VARCHAR ||
+			    func.children[0]->return_type.id() != LogicalTypeId::VARCHAR ||
+			    func.children[1]->return_type.id() != LogicalTypeId::VARCHAR) {
+				return false;
+			}
+		} else {
+			return false;
+		}
+		result = "(" + children[0] + " " + name + " " + children[1] + ")";
+		return true;
+	}
+};
+
+static bool DMLPushdownEnabled(ClientContext &context) {
+	Value dml_pushdown;
+	if (context.TryGetCurrentSetting("pg_dml_pushdown", dml_pushdown)) {
+		return BooleanValue::Get(dml_pushdown);
+	}
+	return true;
+}
+
+static string GetTableName(PostgresTableEntry &table) {
+	return KeywordHelper::WriteQuoted(table.schema.name, '"') + "." +
+	       PostgresUtils::QuotePostgresIdentifier(table.name);
+}
+
+static string GetWhereClause(PostgresDMLTransformer &transformer) {
+	if (transformer.conditions.empty()) {
+		return string();
+	}
+	return " WHERE " + StringUtil::Join(transformer.conditions, " AND ");
+}
+
+//! Translates a plan that produces the rows of an INSERT into a SELECT statement on a table of the catalog
+static bool TransformSelect(Catalog &catalog, LogicalOperator &op, string &result) {
+	PostgresDMLTransformer transformer(catalog);
+	if (!transformer.TransformPlan(op)) {
+		return false;
+	}
+	vector<string> select_list;
+	for (idx_t i = 0; i < op.types.size(); i++) {
+		string column;
+		if (!transformer.TransformColumn(op, i, column)) {
+			return false;
+		}
+		select_list.push_back(std::move(column));
+	}
+	result = "SELECT " + StringUtil::Join(select_list, ", ") + " FROM " + GetTableName(*transformer.table) +
+	         GetWhereClause(transformer);
+	return true;
+}
+
+static string GetColumnList(const vector<string> &names) {
+	vector<string> column_names;
+	for (auto &name : names) {
+		column_names.push_back(KeywordHelper::WriteQuoted(name, '"'));
+	}
+	return StringUtil::Join(column_names, ", ");
+}
+
+//===--------------------------------------------------------------------===//
+// Plan
+//===--------------------------------------------------------------------===//
+optional_ptr<PhysicalOperator> PostgresDMLPushdown::TryPlanDelete(ClientContext &context,
+                                                                  PhysicalPlanGenerator &planner, LogicalDelete &op) {
+	if (!DMLPushdownEnabled(context) || op.return_chunk) {
+		return nullptr;
+	}
+	auto &table = op.table.Cast<PostgresTableEntry>();
+	PostgresDMLTransformer transformer(table);
+	if (!transformer.TransformPlan(*op.children[0])) {
+		return nullptr;
+	}
+	auto sql = "DELETE FROM " + GetTableName(table) + GetWhereClause(transformer);
+	auto &catalog = table.catalog.Cast<PostgresCatalog>();
+	return planner.Make<PostgresRemoteDML>(op.types, catalog, "PG_REMOTE_DELETE", table.name, std::move(sql));
+}
+
+optional_ptr<PhysicalOperator> PostgresDMLPushdown::TryPlanUpdate(ClientContext &context,
+                                                                  PhysicalPlanGenerator &planner, LogicalUpdate &op) {
+	if (!DMLPushdownEnabled(context) || op.return_chunk) {
+		return nullptr;
+	}
+	auto &table = op.table.Cast<PostgresTableEntry>();
+	PostgresDMLTransformer transformer(table);
+	auto &child = *op.children[0];
+	vector<string> set_list;
+	for (idx_t i = 0; i < op.columns.size(); i++) {
+		if (!IsStandardType(table.postgres_types[op.columns[i].index])) {
+			return nullptr;
+		}
+		auto &expr = *op.expressions[i];
+		string value;
+		if (expr.GetExpressionType() == ExpressionType::VALUE_DEFAULT) {
+			value = "DEFAULT";
+		} else if (!transformer.TransformExpression(child, expr, value)) {
+			return nullptr;
+		}
+		auto &column_name = table.postgres_names[op.columns[i].index];
+		set_list.push_back(KeywordHelper::WriteQuoted(column_name, '"') + " = " + value);
+	}
+	if (!transformer.TransformPlan(child)) {
+		return nullptr;
+	}
+	auto sql = "UPDATE " + GetTableName(table) + " SET " + StringUtil::Join(set_list, ", ") +
+	           GetWhereClause(transformer);
+	auto &catalog = table.catalog.Cast<PostgresCatalog>();
+	return planner.Make<PostgresRemoteDML>(op.types, catalog, "PG_REMOTE_UPDATE", table.name, std::move(sql));
+}
+
+optional_ptr<PhysicalOperator> PostgresDMLPushdown::TryPlanInsert(ClientContext &context,
+                                                                  PhysicalPlanGenerator &planner, LogicalInsert &op) {
+	if (!DMLPushdownEnabled(context) || op.return_chunk || op.children.empty()) {
+		return nullptr;
+	}
+	auto action = op.on_conflict_info.action_type;
+	if (action != OnConflictAction::THROW && action != OnConflictAction::NOTHING) {
+		// DO UPDATE goes through a staging table - Postgres cannot update the same row twice in one statement
+		return nullptr;
+	}
+	auto &table = op.table.Cast<PostgresTableEntry>();
+	for (auto &postgres_type : table.postgres_types) {
+		if (!IsStandardType(postgres_type)) {
+			// the values would be inserted without the conversion that is applied when copying
+			return nullptr;
+		}
+	}
+	string select;
+	if (!TransformSelect(table.catalog, *op.children[0], select)) {
+		return nullptr;
+	}
+	// map the output columns of the source onto the columns of the table
+	vector<string> column_names;
+	if (op.column_index_map.empty()) {
+		column_names = table.postgres_names;
+	} else {
+		column_names.resize(op.children[0]->types.size());
+		for (idx_t c = 0; c < op.column_index_map.size(); c++) {
+			auto mapped_index = op.column_index_map[PhysicalIndex(c)];
+			if (mapped_index == DConstants::INVALID_INDEX) {
+				continue;
+			}
+			column_names[mapped_index] = table.postgres_names[c];
+		}
+	}
+	auto sql = "INSERT INTO " + GetTableName(table) + " (" + GetColumnList(column_names) + ") " + select;
+	if (action == OnConflictAction::NOTHING) {
+		vector<string> conflict_columns;
+		sql += TransformOnConflict(context, op, conflict_columns);
+	}
+	auto &catalog = table.catalog.Cast<PostgresCatalog>();
+	return planner.Make<PostgresRemoteDML>(op.types, catalog, "PG_REMOTE_INSERT", table.name, std::move(sql));
+}
+
+optional_ptr<PhysicalOperator> PostgresDMLPushdown::TryPlanCreateTableAs(ClientContext &context,
+                                                                         PhysicalPlanGenerator &planner,
+                                                                         LogicalCreateTable &op) {
+	if (!DMLPushdownEnabled(context) || op.children.empty()) {
+		return nullptr;
+	}
+	auto &child = *op.children[0];
+	for (auto &type : child.types) {
+		if (PostgresUtils::ToPostgresType(type) != type) {
+			// the column types of the table differ from the types produced by the source
+			return nullptr;
+		}
+	}
+	string select;
+	if (!TransformSelect(op.schema.catalog, child, select)) {
+		return nullptr;
+	}
+	auto &create_info = op.info->Base();
+	vector<string> column_names;
+	for (auto &column : create_info.columns.Logical()) {
+		column_names.push_back(column.Name());
+	}
+	auto table_name = KeywordHelper::WriteQuoted(op.schema.name, '"') + "." +
+	                  PostgresUtils::QuotePostgresIdentifier(create_info.table);
+	auto sql = "INSERT INTO " + table_name + " (" + GetColumnList(column_names) + ") " + select;
+	auto &catalog = op.schema.catalog.Cast<PostgresCatalog>();
+	auto &result = planner.Make<PostgresRemoteDML>(op.types, catalog, "PG_REMOTE_CREATE_TABLE_AS", create_info.table,
+	                                               std::move(sql));
+	result.schema = &op.schema;
+	result.info = std::move(op.info);
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// ON CONFLICT
+//===--------------------------------------------------------------------===//
+static vector<column_t> GetConflictTarget(ClientContext &context, PostgresTableEntry &table, LogicalInsert &op) {
+	auto &conflict_info = op.on_conflict_info;
+	vector<column_t> result(conflict_info.on_conflict_filter.begin(), conflict_info.on_conflict_filter.end());
+	if (result.empty() && conflict_info.action_type != OnConflictAction::NOTHING) {
+		// Postgres requires a conflict target for DO UPDATE - use the only unique constraint of the table
+		auto storage_info = table.GetStorageInfo(context);
+		for (auto &index : storage_info.index_info) {
+			if (!index.is_unique && !index.is_primary) {
+				continue;
+			}
+			if (!result.empty()) {
+				throw BinderException("Conflict target has to be provided for a DO UPDATE operation when the table "
+				                      "has multiple UNIQUE/PRIMARY KEY constraints");
+			}
+			result.insert(result.end(), index.column_set.begin(), index.column_set.end());
+		}
+		if (result.empty()) {
+			throw BinderException("ON CONFLICT DO UPDATE requires a UNIQUE/PRIMARY KEY constraint on the table");
+		}
+	}
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+string PostgresDMLPushdown::TransformOnConflict(ClientContext &context, LogicalInsert &op,
+                                                vector<string> &conflict_columns) {
+	auto &table = op.table.Cast<PostgresTableEntry>();
+	auto &conflict_info = op.on_conflict_info;
+	if (conflict_info.on_conflict_condition) {
+		throw BinderException("ON CONFLICT with a WHERE clause on the conflict target is not supported for insertion "
+		                      "into Postgres table");
+	}
+	for (auto &column_id : GetConflictTarget(context, table, op)) {
+		conflict_columns.push_back(KeywordHelper::WriteQuoted(table.postgres_names[column_id], '"'));
+	}
+	string result = " ON CONFLICT";
+	if (!conflict_columns.empty()) {
+		result += " (" + StringUtil::Join(conflict_columns, ", ") + ")";
+	}
+	if (conflict_info.action_type == OnConflictAction::NOTHING) {
+		return result + " DO NOTHING";
+	}
+	// the expressions are evaluated on the excluded (inserted) columns followed by the fetched columns of the table
+	PostgresDMLTransformer transformer(table);
+	auto table_name = PostgresUtils::QuotePostgresIdentifier(table.name);
+	for (auto &name : table.postgres_names) {
+		transformer.column_references.push_back("excluded." + KeywordHelper::WriteQuoted(name, '"'));
+	}
+	for (auto &column_id : conflict_info.columns_to_fetch) {
+		auto &name = table.postgres_names[column_id];
+		transformer.column_references.push_back(table_name + "." + KeywordHelper::WriteQuoted(name, '"'));
+	}
+	vector<string> set_list;
+	for (idx_t i = 0; i < conflict_info.set_columns.size(); i++) {
+		string value;
+		if (!transformer.TransformExpression(op, *op.expressions[i], value)) {
+			throw BinderException("ON CONFLICT DO UPDATE expression \"%s\" cannot be executed in Postgres",
+			                      op.expressions[i]->ToString());
+		}
+		auto &column_name = table.postgres_names[conflict_info.set_columns[i].index];
+		set_list.push_back(KeywordHelper::WriteQuoted(column_name, '"') + " = " + value);
+	}
+	result += " DO UPDATE SET " + StringUtil::Join(set_list, ", ");
+	if (conflict_info.do_update_condition) {
+		string condition;
+		if (!transformer.TransformExpression(op, *conflict_info.do_update_condition, condition)) {
+			throw BinderException("ON CONFLICT DO UPDATE condition \"%s\" cannot be executed in Postgres",
+			                      conflict_info.do_update_condition->ToString());
+		}
+		result += " WHERE " + condition;
+	}
+	return result;
+}
+
+} // namespace duckdb
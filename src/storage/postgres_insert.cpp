@@ -1,5 +1,6 @@
 #include "storage/postgres_insert.hpp"
 #include "storage/postgres_catalog.hpp"
+#include "storage/postgres_dml_pushdown.hpp"
 #include "storage/postgres_transaction.hpp"
 #include "duckdb/planner/operator/logical_insert.hpp"
 #include "duckdb/planner/operator/logical_create_table.hpp"
@@ -9,8 +10,13 @@
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "postgres_binary_writer.hpp"
+#include "postgres_binary_file_reader.hpp"
+#include "storage/postgres_binary_file_scan.hpp"
 #include "postgres_connection.hpp"
 #include "postgres_scanner.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/transaction/transaction_context.hpp"
 
 namespace duckdb {
 
@@ -42,6 +48,55 @@ public:
 	PostgresCopyFormat format;
 	vector<string> insert_column_names;
 	bool copy_is_active = false;
+	//! Whether or not data is written in parallel over separate connections (outside of the transaction)
+	bool parallel = false;
+	bool two_phase_commit = false;
+	//! The number of separate connections that can still be opened by writers
+	atomic<idx_t> available_writers;
+	mutex lock;
+	//! The connections of the finished parallel writers - these are committed in Finalize
+	vector<PostgresPoolConnection> writer_connections;
+	//! The temporary table the rows of an upsert are staged in - it is created when the first rows are copied
+	string upsert_table_name;
+	string upsert_create_sql;
+	bool upsert_table_created = false;
+	//! The statement that merges the staged rows into the table
+	string upsert_sql;
+	idx_t staged_count = 0;
+	//! Whether small inserts are buffered and executed as pipelined prepared statements
+	bool use_pipeline = false;
+	//! The buffered rows (encoded as binary COPY tuples) and the statement that is executed for each of them
+	PostgresCopyState pipeline_state;
+	idx_t pipeline_count = 0;
+	string pipeline_sql;
+	//! The statements that are executed after a bulk load (e.g. to rebuild the indexes of the table)
+	vector<string> bulk_load_finalize;
+
+	void BeginCopyTo(ClientContext &context, PostgresConnection &connection) {
+		if (upsert_table_name.empty()) {
+			connection.BeginCopyTo(context, copy_state, format, table.schema.name, table.name, insert_column_names);
+		} else {
+			if (!upsert_table_created) {
+				connection.Execute(upsert_create_sql);
+				upsert_table_created = true;
+			}
+			connection.BeginCopyTo(context, copy_state, format, string(), upsert_table_name, insert_column_names);
+		}
+		copy_is_active = true;
+		if (use_pipeline) {
+			// too many rows for pipelined statements - move the buffered rows into the copy
+			auto &buffer = pipeline_state.buffer;
+			copy_state.buffer.WriteData(buffer.GetData(), buffer.GetPosition());
+			buffer.Rewind();
+			if (upsert_table_name.empty()) {
+				insert_count += pipeline_count;
+			} else {
+				staged_count += pipeline_count;
+			}
+			pipeline_count = 0;
+			use_pipeline = false;
+		}
+	}
 
 	void FinishCopyTo(PostgresConnection &connection) {
 		if (!copy_is_active) {
@@ -50,6 +105,60 @@ public:
 		connection.FinishCopyTo(copy_state);
 		copy_is_active = false;
 	}
+
+	void FlushUpsert(PostgresConnection &connection) {
+		FinishCopyTo(connection);
+		if (staged_count == 0) {
+			return;
+		}
+		auto result = connection.Query(upsert_sql);
+		insert_count += result->AffectedRows();
+		connection.Execute("TRUNCATE " + PostgresUtils::QuotePostgresIdentifier(upsert_table_name));
+		staged_count = 0;
+	}
+
+	void CommitWriters() {
+		if (!two_phase_commit) {
+			for (auto &writer : writer_connections) {
+				writer.GetConnection().Execute("COMMIT");
+			}
+			writer_connections.clear();
+			return;
+		}
+		// prepare all writers first so that either all or none of the data is committed
+		auto transaction_id = "duckdb_insert_" + UUID::ToString(UUID::GenerateRandomUUID());
+		vector<string> prepared_transactions;
+		try {
+			for (idx_t i = 0; i < writer_connections.size(); i++) {
+				auto gid = KeywordHelper::WriteQuoted(transaction_id + "_" + to_string(i), '\'');
+				writer_connections[i].GetConnection().Execute("PREPARE TRANSACTION " + gid);
+				prepared_transactions.push_back(gid);
+			}
+		} catch (...) {
+			for (idx_t i = 0; i < prepared_transactions.size(); i++) {
+				try {
+					writer_connections[i].GetConnection().Execute("ROLLBACK PREPARED " + prepared_transactions[i]);
+				} catch (...) {
+				}
+			}
+			throw;
+		}
+		for (idx_t i = 0; i < writer_connections.size(); i++) {
+			writer_connections[i].GetConnection().Execute("COMMIT PREPARED " + prepared_transactions[i]);
+		}
+		writer_connections.clear();
+	}
+};
+
+class PostgresInsertLocalState : public LocalSinkState {
+public:
+	//! The separate connection of this writer - if it has none, data is written over the transaction connection
+	PostgresPoolConnection connection;
+	PostgresCopyState copy_state;
+	DataChunk varchar_chunk;
+	idx_t insert_count = 0;
+	bool initialized = false;
+	bool copy_is_active = false;
 };
 
 vector<string> GetInsertColumns(const PostgresInsert &insert, PostgresTableEntry &entry) {
@@ -78,6 +187,140 @@ vector<string> GetInsertColumns(const PostgresInsert &insert, PostgresTableEntry
 	return column_names;
 }
 
+static string GetQualifiedName(PostgresTableEntry &table) {
+	return KeywordHelper::WriteQuoted(table.schema.name, '"') + "." + KeywordHelper::WriteQuoted(table.name, '"');
+}
+
+static string GetQuotedColumnList(PostgresInsertGlobalState &gstate) {
+	auto &names = gstate.insert_column_names.empty() ? gstate.table.postgres_names : gstate.insert_column_names;
+	vector<string> column_names;
+	for (auto &name : names) {
+		column_names.push_back(KeywordHelper::WriteQuoted(name, '"'));
+	}
+	return StringUtil::Join(column_names, ", ");
+}
+
+static void InitializeUpsert(const PostgresInsert &insert, PostgresInsertGlobalState &gstate) {
+	auto &table = gstate.table;
+	// the staging table has an extra column - always copy into an explicit list of columns
+	if (gstate.insert_column_names.empty()) {
+		gstate.insert_column_names = table.postgres_names;
+	}
+	auto column_list = GetQuotedColumnList(gstate);
+	// create a staging table with the exact column types of the table
+	// the insertion index records the order in which rows were copied
+	gstate.upsert_table_name = "upsert_data_" + UUID::ToString(UUID::GenerateRandomUUID());
+	auto upsert_table = PostgresUtils::QuotePostgresIdentifier(gstate.upsert_table_name);
+	gstate.upsert_create_sql = "CREATE LOCAL TEMPORARY TABLE " + upsert_table + " ON COMMIT DROP AS SELECT " +
+	                           column_list + " FROM " + GetQualifiedName(table) + " WITH NO DATA; ALTER TABLE " +
+	                           upsert_table + " ADD COLUMN __insert_index BIGSERIAL";
+	// generate the statement that merges the staged rows into the table
+	string select_sql;
+	if (insert.on_conflict_update) {
+		// Postgres cannot update the same row twice in one statement - only the last row per conflict target is used
+		// DISTINCT ON considers NULLs equal, but rows with a NULL in the conflict target never conflict
+		// these rows are all inserted as-is
+		auto conflict_list = StringUtil::Join(insert.conflict_columns, ", ");
+		vector<string> not_null_conditions;
+		vector<string> null_conditions;
+		for (auto &column : insert.conflict_columns) {
+			not_null_conditions.push_back(column + " IS NOT NULL");
+			null_conditions.push_back(column + " IS NULL");
+		}
+		select_sql = "(SELECT DISTINCT ON (" + conflict_list + ") " + column_list + " FROM " + upsert_table +
+		             " WHERE " + StringUtil::Join(not_null_conditions, " AND ") + " ORDER BY " + conflict_list +
+		             ", __insert_index DESC) UNION ALL (SELECT " + column_list + " FROM " + upsert_table + " WHERE " +
+		             StringUtil::Join(null_conditions, " OR ") + ")";
+	} else {
+		select_sql = "SELECT " + column_list + " FROM " + upsert_table + " ORDER BY __insert_index";
+	}
+	gstate.upsert_sql = "INSERT INTO " + GetQualifiedName(table) + " (" + column_list + ") " + select_sql +
+	                    insert.on_conflict_clause;
+}
+
+static void InitializePipeline(ClientContext &context, const PostgresInsert &insert,
+                               PostgresInsertGlobalState &gstate) {
+	auto &table = gstate.table;
+	auto column_count = gstate.insert_column_names.empty() ? table.postgres_names.size()
+	                                                       : gstate.insert_column_names.size();
+	vector<string> parameters;
+	for (idx_t i = 0; i < column_count; i++) {
+		parameters.push_back("$" + to_string(i + 1));
+	}
+	gstate.use_pipeline = true;
+	gstate.pipeline_state.Initialize(context);
+	gstate.pipeline_state.postgres_types = gstate.copy_state.postgres_types;
+	gstate.pipeline_sql = "INSERT INTO " + GetQualifiedName(table) + " (" + GetQuotedColumnList(gstate) + ") VALUES (" +
+	                      StringUtil::Join(parameters, ", ") + ")" + insert.on_conflict_clause;
+}
+
+static void InitializeBulkLoad(PostgresConnection &connection, const PostgresInsert &insert,
+                               PostgresInsertGlobalState &gstate) {
+	auto &table = gstate.table;
+	auto table_name = GetQualifiedName(table);
+	vector<string> drop_statements;
+	vector<string> create_statements;
+	vector<string> index_statements;
+	if (insert.table) {
+		// only empty, regular tables that are not involved in foreign keys or publications can be bulk loaded
+		auto table_oid = KeywordHelper::WriteQuoted(table_name, '\'') + "::regclass";
+		auto result = connection.Query(StringUtil::Format(R"(
+SELECT c.relkind = 'r' AND c.relpersistence = 'p'
+	AND NOT EXISTS (SELECT 1 FROM pg_constraint WHERE contype = 'f' AND (conrelid = c.oid OR confrelid = c.oid))
+	AND NOT EXISTS (SELECT 1 FROM pg_publication_rel WHERE prrelid = c.oid)
+	AND NOT EXISTS (SELECT 1 FROM pg_publication WHERE puballtables)
+	AND NOT EXISTS (SELECT 1 FROM %s)
+FROM pg_class c
+WHERE c.oid = %s
+)",
+		                                                  table_name, table_oid));
+		if (result->Count() != 1 || !result->GetBool(0, 0)) {
+			return;
+		}
+		// the constraints are dropped and re-added, other indexes are dropped and re-created
+		result = connection.Query(StringUtil::Format(R"(
+SELECT 'constraint', quote_ident(conname), pg_get_constraintdef(oid)
+FROM pg_constraint
+WHERE conrelid = %s AND contype IN ('p', 'u', 'x')
+UNION ALL
+SELECT 'index', indexrelid::regclass::text, pg_get_indexdef(indexrelid)
+FROM pg_index
+WHERE indrelid = %s AND NOT EXISTS (SELECT 1 FROM pg_constraint WHERE conrelid = %s AND conindid = indexrelid)
+)",
+		                                             table_oid, table_oid, table_oid));
+		for (idx_t row = 0; row < result->Count(); row++) {
+			auto name = result->GetString(row, 1);
+			auto definition = result->GetString(row, 2);
+			if (result->GetString(row, 0) == "index") {
+				drop_statements.push_back("DROP INDEX " + name);
+				index_statements.push_back(definition);
+			} else {
+				drop_statements.push_back("ALTER TABLE " + table_name + " DROP CONSTRAINT " + name);
+				create_statements.push_back("ALTER TABLE " + table_name + " ADD CONSTRAINT " + name + " " + definition);
+			}
+		}
+	} else if (insert.info->Base().temporary || StringUtil::StartsWith(table.schema.name, "pg_temp")) {
+		// temporary tables are never logged
+		return;
+	}
+	drop_statements.push_back("ALTER TABLE " + table_name + " SET UNLOGGED");
+	connection.Execute(StringUtil::Join(drop_statements, "; "));
+	// make the table logged before building the indexes - SET LOGGED rewrites the indexes of the table
+	if (insert.bulk_load_set_logged) {
+		gstate.bulk_load_finalize.push_back("ALTER TABLE " + table_name + " SET LOGGED");
+	}
+	// add the constraints before the remaining indexes
+	for (auto &statement : create_statements) {
+		gstate.bulk_load_finalize.push_back(std::move(statement));
+	}
+	for (auto &statement : index_statements) {
+		gstate.bulk_load_finalize.push_back(std::move(statement));
+	}
+	if (insert.bulk_load_analyze) {
+		gstate.bulk_load_finalize.push_back("ANALYZE " + table_name);
+	}
+}
+
 unique_ptr<GlobalSinkState> PostgresInsert::GetGlobalSinkState(ClientContext &context) const {
 	optional_ptr<PostgresTableEntry> insert_table;
 	if (!table) {
@@ -87,40 +330,144 @@ unique_ptr<GlobalSinkState> PostgresInsert::GetGlobalSinkState(ClientContext &co
 	} else {
 		insert_table = &table.get_mutable()->Cast<PostgresTableEntry>();
 	}
-	auto &transaction = PostgresTransaction::Get(context, insert_table->catalog);
-	auto &connection = transaction.GetConnection();
 	auto insert_columns = GetInsertColumns(*this, *insert_table);
-	auto format = insert_table->GetCopyFormat(context);
+	// raw binary COPY tuples can only be sent in the binary format
+	auto format = raw_copy ? PostgresCopyFormat::BINARY : insert_table->GetCopyFormat(context);
 	auto result = make_uniq<PostgresInsertGlobalState>(context, *insert_table, format);
+	// parallel writers commit separately - only use them for inserts into existing tables in auto-commit mode
+	// tables created or modified within this transaction are not visible to (or locked for) other connections
+	// bulk loads lock the table within the transaction - they are written over the transaction connection
+	if (insert_connections > 1 && table && keep_copy_alive && on_conflict_clause.empty() && !bulk_load &&
+	    context.transaction.IsAutoCommit() && !StringUtil::StartsWith(insert_table->schema.name, "pg_temp")) {
+		result->parallel = true;
+		result->two_phase_commit = two_phase_commit;
+		result->available_writers = insert_connections;
+	}
 	auto &insert_column_names = result->insert_column_names;
+	auto &insert_postgres_types = result->copy_state.postgres_types;
 	if (!insert_columns.empty()) {
 		for (auto &str : insert_columns) {
 			auto index = insert_table->GetColumnIndex(str, true);
 			if (!index.IsValid()) {
 				insert_column_names.push_back(str);
+				insert_postgres_types.emplace_back();
 			} else {
 				insert_column_names.push_back(insert_table->postgres_names[index.index]);
+				insert_postgres_types.push_back(insert_table->postgres_types[index.index]);
 			}
 		}
+	} else {
+		insert_postgres_types = insert_table->postgres_types;
+	}
+	if (!on_conflict_clause.empty()) {
+		InitializeUpsert(*this, *result);
+	}
+	if (bulk_load && on_conflict_clause.empty()) {
+		auto &transaction = PostgresTransaction::Get(context, insert_table->catalog);
+		InitializeBulkLoad(transaction.GetConnection(), *this, *result);
+	}
+	if (small_dml_threshold > 0 && table && !raw_copy && !result->parallel && result->bulk_load_finalize.empty() &&
+	    on_conflict_clause.empty() && format == PostgresCopyFormat::BINARY) {
+		// parameters are sent in the binary format - this requires the same types as a binary copy
+		// upserts always go through the staging table, which keeps only the last row for every conflict key
+		InitializePipeline(context, *this, *result);
 	}
 	return std::move(result);
 }
 
+unique_ptr<LocalSinkState> PostgresInsert::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<PostgresInsertLocalState>();
+}
+
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+//! Copies the rows of the chunk into the table - returns the number of copied rows
+static idx_t CopyChunk(ClientContext &context, const PostgresInsert &insert, PostgresConnection &connection,
+                       PostgresCopyState &state, DataChunk &chunk, DataChunk &varchar_chunk) {
+	if (!insert.raw_copy) {
+		connection.CopyChunk(context, state, chunk, varchar_chunk);
+		return chunk.size();
+	}
+	// every row holds a batch of binary COPY tuples and the number of tuples in the batch
+	chunk.Flatten();
+	auto tuples = FlatVector::GetData<string_t>(chunk.data[0]);
+	auto tuple_counts = FlatVector::GetData<int64_t>(chunk.data[1]);
+	idx_t row_count = 0;
+	for (idx_t r = 0; r < chunk.size(); r++) {
+		state.buffer.WriteData(const_data_ptr_cast(tuples[r].GetData()), tuples[r].GetSize());
+		connection.FlushCopyData(state);
+		row_count += NumericCast<idx_t>(tuple_counts[r]);
+	}
+	return row_count;
+}
+
+static bool InitializeWriter(PostgresInsertGlobalState &gstate, PostgresInsertLocalState &lstate) {
+	if (lstate.initialized) {
+		return lstate.connection.HasConnection();
+	}
+	lstate.initialized = true;
+	if (!gstate.parallel) {
+		return false;
+	}
+	// claim a writer slot
+	auto available_writers = gstate.available_writers.load();
+	do {
+		if (available_writers == 0) {
+			return false;
+		}
+	} while (!gstate.available_writers.compare_exchange_weak(available_writers, available_writers - 1));
+	auto &catalog = gstate.table.catalog.Cast<PostgresCatalog>();
+	if (!catalog.GetConnectionPool().TryGetConnection(lstate.connection)) {
+		// all connections are in use - share the transaction connection instead and release the slot for other threads
+		gstate.available_writers++;
+		return false;
+	}
+	lstate.connection.GetConnection().Execute("BEGIN");
+	return true;
+}
+
 SinkResultType PostgresInsert::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &gstate = input.global_state.Cast<PostgresInsertGlobalState>();
+	auto &lstate = input.local_state.Cast<PostgresInsertLocalState>();
+	if (InitializeWriter(gstate, lstate)) {
+		// write the data over our own connection
+		auto &connection = lstate.connection.GetConnection();
+		if (!lstate.copy_is_active) {
+			lstate.copy_state.postgres_types = gstate.copy_state.postgres_types;
+			connection.BeginCopyTo(context.client, lstate.copy_state, gstate.format, gstate.table.schema.name,
+			                       gstate.table.name, gstate.insert_column_names);
+			lstate.copy_is_active = true;
+		}
+		lstate.insert_count += CopyChunk(context.client, *this, connection, lstate.copy_state, chunk,
+		                                 lstate.varchar_chunk);
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+	lock_guard<mutex> guard(gstate.lock);
+	if (gstate.use_pipeline && gstate.pipeline_count + chunk.size() < small_dml_threshold) {
+		// small insert - buffer the rows so they can be sent as pipelined statements
+		chunk.Flatten();
+		PostgresBinaryWriter writer(gstate.pipeline_state);
+		writer.WriteChunk(chunk);
+		gstate.pipeline_count += chunk.size();
+		return SinkResultType::NEED_MORE_INPUT;
+	}
 	auto &transaction = PostgresTransaction::Get(context.client, gstate.table.catalog);
 	auto &connection = transaction.GetConnection();
 	if (!gstate.copy_is_active) {
 		// copy hasn't started yet
-		connection.BeginCopyTo(context.client, gstate.copy_state, gstate.format, gstate.table.schema.name,
-		                       gstate.table.name, gstate.insert_column_names);
-		gstate.copy_is_active = true;
+		gstate.BeginCopyTo(context.client, connection);
+	}
+	auto row_count = CopyChunk(context.client, *this, connection, gstate.copy_state, chunk, gstate.varchar_chunk);
+	if (!gstate.upsert_table_name.empty()) {
+		// upsert: the affected rows are counted when the staged rows are merged
+		gstate.staged_count += row_count;
+		if (gstate.staged_count >= UPSERT_BATCH_SIZE) {
+			gstate.FlushUpsert(connection);
+		}
+	} else {
+		gstate.insert_count += row_count;
 	}
-	connection.CopyChunk(context.client, gstate.copy_state, chunk, gstate.varchar_chunk);
-	gstate.insert_count += chunk.size();
 	if (!keep_copy_alive) {
 		// if we are can't keep the copy alive we need to restart the copy during every sink
 		gstate.FinishCopyTo(connection);
@@ -128,6 +475,25 @@ SinkResultType PostgresInsert::Sink(ExecutionContext &context, DataChunk &chunk,
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+//===--------------------------------------------------------------------===//
+// Combine
+//===--------------------------------------------------------------------===//
+SinkCombineResultType PostgresInsert::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<PostgresInsertGlobalState>();
+	auto &lstate = input.local_state.Cast<PostgresInsertLocalState>();
+	if (!lstate.connection.HasConnection()) {
+		return SinkCombineResultType::FINISHED;
+	}
+	if (lstate.copy_is_active) {
+		lstate.connection.GetConnection().FinishCopyTo(lstate.copy_state);
+		lstate.copy_is_active = false;
+	}
+	lock_guard<mutex> guard(gstate.lock);
+	gstate.insert_count += lstate.insert_count;
+	gstate.writer_connections.push_back(std::move(lstate.connection));
+	return SinkCombineResultType::FINISHED;
+}
+
 //===--------------------------------------------------------------------===//
 // Finalize
 //===--------------------------------------------------------------------===//
@@ -136,7 +502,19 @@ SinkFinalizeType PostgresInsert::Finalize(Pipeline &pipeline, Event &event, Clie
 	auto &gstate = input.global_state.Cast<PostgresInsertGlobalState>();
 	auto &transaction = PostgresTransaction::Get(context, gstate.table.catalog);
 	auto &connection = transaction.GetConnection();
-	gstate.FinishCopyTo(connection);
+	if (gstate.pipeline_count > 0) {
+		// small insert - execute one INSERT per row in a single round trip
+		auto &buffer = gstate.pipeline_state.buffer;
+		gstate.insert_count += connection.ExecutePipelined(gstate.pipeline_sql, buffer.GetData(), buffer.GetPosition());
+	} else if (gstate.upsert_table_name.empty()) {
+		gstate.FinishCopyTo(connection);
+	} else {
+		gstate.FlushUpsert(connection);
+	}
+	gstate.CommitWriters();
+	if (!gstate.bulk_load_finalize.empty()) {
+		connection.Execute(StringUtil::Join(gstate.bulk_load_finalize, "; "));
+	}
 	// update the approx_num_pages - approximately 8 bytes per column per row
 	idx_t bytes_per_page = 8192;
 	idx_t bytes_per_row = gstate.table.GetColumns().LogicalColumnCount() * 8;
@@ -167,6 +545,18 @@ string PostgresInsert::GetName() const {
 InsertionOrderPreservingMap<string> PostgresInsert::ParamsToString() const {
 	InsertionOrderPreservingMap<string> result;
 	result["Table Name"] = table ? table->name : info->Base().table;
+	if (!on_conflict_clause.empty()) {
+		result["On Conflict"] = on_conflict_clause;
+	}
+	if (bulk_load) {
+		result["Bulk Load"] = "true";
+	}
+	if (raw_copy) {
+		result["Raw Copy"] = "true";
+	}
+	if (insert_connections > 1) {
+		result["Insert Connections"] = to_string(insert_connections);
+	}
 	return result;
 }
 
@@ -232,30 +622,143 @@ void PostgresCatalog::MaterializePostgresScans(PhysicalOperator &op) {
 	}
 }
 
+//! Returns the bind data of a COPY ... FROM (FORMAT postgres_binary) scan that reads all columns of the files in order
+static optional_ptr<ReadPostgresBinaryBindData> GetBinaryCopyFromScan(PhysicalOperator &plan) {
+	if (plan.type != PhysicalOperatorType::TABLE_SCAN) {
+		return nullptr;
+	}
+	auto &table_scan = plan.Cast<PhysicalTableScan>();
+	if (table_scan.function.name != "read_postgres_binary" || !table_scan.bind_data) {
+		return nullptr;
+	}
+	auto &bind_data = table_scan.bind_data->Cast<ReadPostgresBinaryBindData>();
+	if (!bind_data.copy_from || table_scan.column_ids.size() != bind_data.types.size()) {
+		return nullptr;
+	}
+	for (idx_t i = 0; i < table_scan.column_ids.size(); i++) {
+		if (table_scan.column_ids[i].GetPrimaryIndex() != i) {
+			return nullptr;
+		}
+	}
+	for (idx_t i = 0; i < table_scan.projection_ids.size(); i++) {
+		if (table_scan.projection_ids[i] != i) {
+			return nullptr;
+		}
+	}
+	return &bind_data;
+}
+
+static void SetBulkLoadSettings(ClientContext &context, PostgresInsert &insert) {
+	Value bulk_load;
+	if (context.TryGetCurrentSetting("pg_bulk_load", bulk_load)) {
+		insert.bulk_load = BooleanValue::Get(bulk_load);
+	}
+	Value set_logged;
+	if (context.TryGetCurrentSetting("pg_bulk_load_set_logged", set_logged)) {
+		insert.bulk_load_set_logged = BooleanValue::Get(set_logged);
+	}
+	Value analyze;
+	if (context.TryGetCurrentSetting("pg_bulk_load_analyze", analyze)) {
+		insert.bulk_load_analyze = BooleanValue::Get(analyze);
+	}
+}
+
+//! Whether the rows of the insert can be written over separate connections (outside of the transaction)
+static bool CanInsertInParallel(ClientContext &context, const PostgresInsert &insert, idx_t estimated_cardinality) {
+	if (insert.insert_connections <= 1 || !insert.table || !insert.keep_copy_alive) {
+		return false;
+	}
+	// upserts merge the rows in the order in which they were staged - which requires a single writer
+	// bulk loads lock the table within the transaction - they are written over the transaction connection
+	if (!insert.on_conflict_clause.empty() || insert.bulk_load) {
+		return false;
+	}
+	// small inserts are executed as pipelined statements over the transaction connection
+	if (insert.small_dml_threshold > 0 && !insert.raw_copy && estimated_cardinality < insert.small_dml_threshold) {
+		return false;
+	}
+	// tables modified within an explicit transaction are not visible to (or locked for) other connections
+	if (!context.transaction.IsAutoCommit()) {
+		return false;
+	}
+	return !StringUtil::StartsWith(insert.table->schema.name, "pg_temp");
+}
+
 PhysicalOperator &PostgresCatalog::PlanInsert(ClientContext &context, PhysicalPlanGenerator &planner, LogicalInsert &op,
                                               optional_ptr<PhysicalOperator> plan) {
 	if (op.return_chunk) {
 		throw BinderException("RETURNING clause not yet supported for insertion into Postgres table");
 	}
-	if (op.on_conflict_info.action_type != OnConflictAction::THROW) {
-		throw BinderException("ON CONFLICT clause not yet supported for insertion into Postgres table");
-	}
 
 	D_ASSERT(plan);
+	auto remote_insert = PostgresDMLPushdown::TryPlanInsert(context, planner, op);
+	if (remote_insert) {
+		return *remote_insert;
+	}
 	MaterializePostgresScans(*plan);
-	auto &inner_plan = AddCastToPostgresTypes(context, planner, *plan);
+	auto binary_copy = GetBinaryCopyFromScan(*plan);
+	optional_ptr<PhysicalOperator> inner_plan;
+	if (binary_copy) {
+		// COPY ... FROM (FORMAT postgres_binary) - the tuples in the files are sent to Postgres without decoding them
+		// the values in the files are in the binary format of the Postgres types of the columns they are copied into
+		auto &table = op.table.Cast<PostgresTableEntry>();
+		vector<PostgresType> target_types;
+		if (op.column_index_map.empty()) {
+			target_types = table.postgres_types;
+		} else {
+			target_types.resize(binary_copy->types.size());
+			for (idx_t c = 0; c < op.column_index_map.size(); c++) {
+				auto mapped_index = op.column_index_map[PhysicalIndex(c)];
+				if (mapped_index != DConstants::INVALID_INDEX) {
+					target_types[mapped_index] = table.postgres_types[c];
+				}
+			}
+		}
+		auto field_lengths = binary_copy->GetFieldLengths(target_types);
+		inner_plan = &planner.Make<PostgresBinaryFileScan>(*binary_copy, std::move(field_lengths),
+		                                                   plan->estimated_cardinality);
+	} else {
+		inner_plan = &AddCastToPostgresTypes(context, planner, *plan);
+	}
 
 	auto &insert = planner.Make<PostgresInsert>(op, op.table, op.column_index_map);
-	insert.children.push_back(inner_plan);
+	insert.raw_copy = binary_copy.get() != nullptr;
+	if (op.on_conflict_info.action_type != OnConflictAction::THROW) {
+		insert.on_conflict_clause = PostgresDMLPushdown::TransformOnConflict(context, op, insert.conflict_columns);
+		insert.on_conflict_update = op.on_conflict_info.action_type != OnConflictAction::NOTHING;
+	}
+	Value insert_connections;
+	if (context.TryGetCurrentSetting("pg_insert_connections", insert_connections)) {
+		insert.insert_connections = UBigIntValue::Get(insert_connections);
+	}
+	Value two_phase_commit;
+	if (context.TryGetCurrentSetting("pg_insert_two_phase_commit", two_phase_commit)) {
+		insert.two_phase_commit = BooleanValue::Get(two_phase_commit);
+	}
+	Value small_dml_threshold;
+	if (context.TryGetCurrentSetting("pg_small_dml_threshold", small_dml_threshold)) {
+		insert.small_dml_threshold = UBigIntValue::Get(small_dml_threshold);
+	}
+	SetBulkLoadSettings(context, insert);
+	if (!CanInsertInParallel(context, insert, plan->estimated_cardinality)) {
+		// the sink is only parallel if the rows are actually written over separate connections
+		insert.insert_connections = 1;
+	}
+	insert.children.push_back(*inner_plan);
 	return insert;
 }
 
 PhysicalOperator &PostgresCatalog::PlanCreateTableAs(ClientContext &context, PhysicalPlanGenerator &planner,
                                                      LogicalCreateTable &op, PhysicalOperator &plan) {
+	auto remote_create = PostgresDMLPushdown::TryPlanCreateTableAs(context, planner, op);
+	if (remote_create) {
+		return *remote_create;
+	}
 	auto &inner_plan = AddCastToPostgresTypes(context, planner, plan);
 	MaterializePostgresScans(inner_plan);
 
 	auto &insert = planner.Make<PostgresInsert>(op, op.schema, std::move(op.info));
+	SetBulkLoadSettings(context, insert);
 	insert.children.push_back(inner_plan);
 	return insert;
 }
@@ -0,0 +1,114 @@
+#include "duckdb.hpp"
+
+#include "postgres_scanner.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "storage/postgres_catalog.hpp"
+
+namespace duckdb {
+
+struct PoolStatsEntry {
+	string connection_string;
+	vector<Value> database_names;
+	PostgresConnectionPoolStatistics statistics;
+};
+
+struct PoolStatsFunctionData : public TableFunctionData {
+	vector<PoolStatsEntry> entries;
+	bool collected = false;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> PoolStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                              vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("connection_string");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("database_names");
+	return_types.emplace_back(LogicalType::LIST(LogicalType::VARCHAR));
+
+	names.emplace_back("open_connections");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("active_connections");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("idle_connections");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("max_connections");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("connections_created");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("connections_reset");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("connection_failures");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("connection_requests");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("total_wait_time_ms");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("p99_wait_time_ms");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return make_uniq<PoolStatsFunctionData>();
+}
+
+static void PoolStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.bind_data->CastNoConst<PoolStatsFunctionData>();
+	if (!data.collected) {
+		// pools are shared by all catalogs and scans using the same connection string - report each pool once
+		auto databases = DatabaseManager::Get(context).GetDatabases(context);
+		for (auto &pool : PostgresConnectionPool::GetPools()) {
+			PoolStatsEntry entry;
+			entry.connection_string = pool->GetDisplayConnectionString();
+			for (auto &db_ref : databases) {
+				auto &db = db_ref.get();
+				auto &catalog = db.GetCatalog();
+				if (catalog.GetCatalogType() != "postgres") {
+					continue;
+				}
+				if (&catalog.Cast<PostgresCatalog>().GetConnectionPool() == pool.get()) {
+					entry.database_names.emplace_back(db.GetName());
+				}
+			}
+			entry.statistics = pool->GetStatistics();
+			data.entries.push_back(std::move(entry));
+		}
+		std::sort(data.entries.begin(), data.entries.end(), [](const PoolStatsEntry &a, const PoolStatsEntry &b) {
+			return a.connection_string < b.connection_string;
+		});
+		data.collected = true;
+	}
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset];
+		auto &stats = entry.statistics;
+		output.SetValue(0, count, Value(entry.connection_string));
+		output.SetValue(1, count, Value::LIST(LogicalType::VARCHAR, entry.database_names));
+		output.SetValue(2, count, Value::UBIGINT(stats.active_connections + stats.idle_connections));
+		output.SetValue(3, count, Value::UBIGINT(stats.active_connections));
+		output.SetValue(4, count, Value::UBIGINT(stats.idle_connections));
+		output.SetValue(5, count, Value::UBIGINT(stats.maximum_connections));
+		output.SetValue(6, count, Value::UBIGINT(stats.connections_created));
+		output.SetValue(7, count, Value::UBIGINT(stats.connections_reset));
+		output.SetValue(8, count, Value::UBIGINT(stats.connection_failures));
+		output.SetValue(9, count, Value::UBIGINT(stats.connection_requests));
+		output.SetValue(10, count, Value::DOUBLE(double(stats.total_wait_time) / 1000.0));
+		output.SetValue(11, count, Value::DOUBLE(double(stats.p99_wait_time) / 1000.0));
+		data.offset++;
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+PostgresPoolStatsFunction::PostgresPoolStatsFunction()
+    : TableFunction("postgres_pool_stats", {}, PoolStatsFunction, PoolStatsBind) {
+}
+} // namespace duckdb
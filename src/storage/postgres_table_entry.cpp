@@ -92,20 +92,20 @@ TableStorageInfo PostgresTableEntry::GetStorageInfo(ClientContext &context) {
 }
 
 static bool CopyRequiresText(const LogicalType &type, const PostgresType &pg_type) {
-	if (pg_type.info != PostgresTypeAnnotation::STANDARD) {
+	switch (pg_type.info) {
+	case PostgresTypeAnnotation::STANDARD:
+	case PostgresTypeAnnotation::JSONB:
+		break;
+	default:
 		return true;
 	}
 	switch (type.id()) {
 	case LogicalTypeId::LIST: {
 		D_ASSERT(pg_type.children.size() == 1);
 		auto &child_type = ListType::GetChildType(type);
-		if (child_type.id() != LogicalTypeId::LIST) {
-			if (!PostgresUtils::SupportedPostgresOid(child_type)) {
-				return true;
-			}
-			if (pg_type.children[0].oid != PostgresUtils::ToPostgresOid(child_type)) {
-				return true;
-			}
+		if (child_type.id() != LogicalTypeId::LIST && pg_type.children[0].oid == 0) {
+			// the binary array format contains the element oid - we need to know the exact element type
+			return true;
 		}
 		if (CopyRequiresText(child_type, pg_type.children[0])) {
 			return true;
@@ -116,7 +116,8 @@ static bool CopyRequiresText(const LogicalType &type, const PostgresType &pg_typ
 		auto &children = StructType::GetChildTypes(type);
 		D_ASSERT(children.size() == pg_type.children.size());
 		for (idx_t c = 0; c < pg_type.children.size(); c++) {
-			if (!PostgresUtils::SupportedPostgresOid(children[c].second)) {
+			// the binary composite format contains the oid of every field
+			if (pg_type.children[c].oid == 0) {
 				return true;
 			}
 			if (CopyRequiresText(children[c].second, pg_type.children[c])) {
@@ -131,15 +132,24 @@ static bool CopyRequiresText(const LogicalType &type, const PostgresType &pg_typ
 }
 
 PostgresCopyFormat PostgresTableEntry::GetCopyFormat(ClientContext &context) {
+	D_ASSERT(postgres_types.size() == columns.LogicalColumnCount());
+	vector<PhysicalIndex> column_ids;
+	for (idx_t c = 0; c < postgres_types.size(); c++) {
+		column_ids.emplace_back(c);
+	}
+	return GetCopyFormat(context, column_ids);
+}
+
+PostgresCopyFormat PostgresTableEntry::GetCopyFormat(ClientContext &context, const vector<PhysicalIndex> &column_ids) {
 	Value use_binary_copy;
 	if (context.TryGetCurrentSetting("pg_use_binary_copy", use_binary_copy)) {
 		if (!BooleanValue::Get(use_binary_copy)) {
 			return PostgresCopyFormat::TEXT;
 		}
 	}
-	D_ASSERT(postgres_types.size() == columns.LogicalColumnCount());
-	for (idx_t c = 0; c < postgres_types.size(); c++) {
-		if (CopyRequiresText(columns.GetColumn(LogicalIndex(c)).GetType(), postgres_types[c])) {
+	for (auto &column_id : column_ids) {
+		auto &col = columns.GetColumn(LogicalIndex(column_id.index));
+		if (CopyRequiresText(col.GetType(), postgres_types[column_id.index])) {
 			return PostgresCopyFormat::TEXT;
 		}
 	}
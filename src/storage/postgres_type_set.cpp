@@ -84,7 +84,8 @@ void PostgresTypeSet::InitializeEnums(PostgresTransaction &transaction, Postgres
 
 string PostgresTypeSet::GetInitializeCompositesQuery(const string &schema) {
 	string base_query = R"(
-SELECT n.oid, t.typrelid AS id, t.typname as type, pg_attribute.attname, sub_type.typname
+SELECT n.oid, t.typrelid AS id, t.typname as type, pg_attribute.attname, sub_type.typname,
+    sub_type.oid AS sub_type_oid, sub_type.typelem AS sub_type_element_oid, t.oid AS type_oid
 FROM pg_type t
 JOIN pg_catalog.pg_namespace n ON n.oid = t.typnamespace
 JOIN pg_class ON pg_class.oid = t.typrelid
@@ -106,7 +107,7 @@ void PostgresTypeSet::CreateCompositeType(PostgresTransaction &transaction, Post
                                           idx_t end_row) {
 	PostgresType postgres_type;
 	CreateTypeInfo info;
-	postgres_type.oid = result.GetInt64(start_row, 1);
+	postgres_type.oid = result.GetInt64(start_row, 7);
 	info.name = result.GetString(start_row, 2);
 
 	child_list_t<LogicalType> child_types;
@@ -114,6 +115,8 @@ void PostgresTypeSet::CreateCompositeType(PostgresTransaction &transaction, Post
 		auto type_name = result.GetString(row, 3);
 		PostgresTypeData type_data;
 		type_data.type_name = result.GetString(row, 4);
+		type_data.type_oid = result.GetInt64(row, 5);
+		type_data.element_oid = result.GetInt64(row, 6);
 		PostgresType child_type;
 		child_types.push_back(
 		    make_pair(type_name, PostgresUtils::TypeToLogicalType(&transaction, &schema, type_data, child_type)));
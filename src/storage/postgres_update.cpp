@@ -2,8 +2,10 @@
 #include "storage/postgres_table_entry.hpp"
 #include "duckdb/planner/operator/logical_update.hpp"
 #include "storage/postgres_catalog.hpp"
+#include "storage/postgres_dml_pushdown.hpp"
 #include "storage/postgres_transaction.hpp"
 #include "postgres_connection.hpp"
+#include "postgres_binary_writer.hpp"
 #include "duckdb/common/types/uuid.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 
@@ -20,17 +22,47 @@ PostgresUpdate::PostgresUpdate(PhysicalPlan &physical_plan, LogicalOperator &op,
 //===--------------------------------------------------------------------===//
 class PostgresUpdateGlobalState : public GlobalSinkState {
 public:
-	explicit PostgresUpdateGlobalState(PostgresTableEntry &table) : table(table), update_count(0) {
+	explicit PostgresUpdateGlobalState(PostgresTableEntry &table, PostgresCopyFormat format)
+	    : table(table), format(format), update_count(0) {
 	}
 
 	PostgresTableEntry &table;
+	PostgresCopyFormat format;
 	PostgresCopyState copy_state;
 	DataChunk insert_chunk;
 	DataChunk varchar_chunk;
 	string update_sql;
 	string update_table_name;
+	string create_table_sql;
 	idx_t update_count;
 	bool copy_is_active = false;
+	bool table_created = false;
+	//! Whether small updates are buffered and executed as pipelined prepared statements
+	bool use_pipeline = false;
+	//! The buffered rows (encoded as binary COPY tuples) and the statement that is executed for each of them
+	PostgresCopyState pipeline_state;
+	idx_t pipeline_count = 0;
+	string pipeline_sql;
+
+	void BeginCopyTo(ClientContext &context, PostgresConnection &connection) {
+		if (!table_created) {
+			// create a temporary table to stream the update data into
+			connection.Execute(create_table_sql);
+			table_created = true;
+		}
+		string schema_name;
+		vector<string> column_names;
+		connection.BeginCopyTo(context, copy_state, format, schema_name, update_table_name, column_names);
+		copy_is_active = true;
+		if (use_pipeline) {
+			// too many rows for pipelined statements - move the buffered rows into the copy
+			auto &buffer = pipeline_state.buffer;
+			copy_state.buffer.WriteData(buffer.GetData(), buffer.GetPosition());
+			buffer.Rewind();
+			pipeline_count = 0;
+			use_pipeline = false;
+		}
+	}
 
 	void FinishCopyTo(PostgresConnection &connection) {
 		if (!copy_is_active) {
@@ -42,18 +74,37 @@ public:
 };
 
 string CreateUpdateTable(const string &name, PostgresTableEntry &table, const vector<PhysicalIndex> &index) {
+	// copy the column types from the table itself so that the data can be copied with the exact same types
 	string result;
 	result = "CREATE LOCAL TEMPORARY TABLE " + PostgresUtils::QuotePostgresIdentifier(name);
-	result += "(";
+	result += " ON COMMIT DROP AS SELECT ";
 	for (idx_t i = 0; i < index.size(); i++) {
 		auto &column_name = table.postgres_names[index[i].index];
-		auto &col = table.GetColumn(LogicalIndex(index[i].index));
 		result += KeywordHelper::WriteQuoted(column_name, '"');
-		result += " ";
-		result += PostgresUtils::TypeToString(col.GetType());
 		result += ", ";
 	}
-	result += "__page_id_string VARCHAR) ON COMMIT DROP;";
+	result += "ctid AS __page_id FROM ";
+	result += KeywordHelper::WriteQuoted(table.schema.name, '"') + ".";
+	result += KeywordHelper::WriteQuoted(table.name, '"');
+	result += " WITH NO DATA;";
+	return result;
+}
+
+string GetPipelinedUpdateSQL(PostgresTableEntry &table, const vector<PhysicalIndex> &index) {
+	string result;
+	result = "UPDATE ";
+	result += KeywordHelper::WriteQuoted(table.schema.name, '"') + ".";
+	result += KeywordHelper::WriteQuoted(table.name, '"');
+	result += " SET ";
+	for (idx_t i = 0; i < index.size(); i++) {
+		if (i > 0) {
+			result += ", ";
+		}
+		auto &column_name = table.postgres_names[index[i].index];
+		result += KeywordHelper::WriteQuoted(column_name, '"');
+		result += " = $" + to_string(i + 1);
+	}
+	result += " WHERE ctid = $" + to_string(index.size() + 1);
 	return result;
 }
 
@@ -77,19 +128,18 @@ string GetUpdateSQL(const string &name, PostgresTableEntry &table, const vector<
 	result += " FROM " + PostgresUtils::QuotePostgresIdentifier(name);
 	result += " WHERE ";
 	result += KeywordHelper::WriteQuoted(table.name, '"');
-	result += ".ctid=__page_id_string::TID";
+	result += ".ctid=__page_id";
 	return result;
 }
 
 unique_ptr<GlobalSinkState> PostgresUpdate::GetGlobalSinkState(ClientContext &context) const {
 	auto &postgres_table = table.Cast<PostgresTableEntry>();
 
-	auto &transaction = PostgresTransaction::Get(context, postgres_table.catalog);
-	auto result = make_uniq<PostgresUpdateGlobalState>(postgres_table);
-	auto &connection = transaction.GetConnection();
-	// create a temporary table to stream the update data into
+	auto format = postgres_table.GetCopyFormat(context, columns);
+	auto result = make_uniq<PostgresUpdateGlobalState>(postgres_table, format);
+	// the temporary table to stream the update data into is only created once rows are copied
 	result->update_table_name = "update_data_" + UUID::ToString(UUID::GenerateRandomUUID());
-	connection.Execute(CreateUpdateTable(result->update_table_name, postgres_table, columns));
+	result->create_table_sql = CreateUpdateTable(result->update_table_name, postgres_table, columns);
 	// generate the final UPDATE sql
 	result->update_sql = GetUpdateSQL(result->update_table_name, postgres_table, columns);
 	// initialize the insertion chunk
@@ -97,15 +147,37 @@ unique_ptr<GlobalSinkState> PostgresUpdate::GetGlobalSinkState(ClientContext &co
 	for (idx_t i = 0; i < columns.size(); i++) {
 		auto &col = table.GetColumn(LogicalIndex(columns[i].index));
 		insert_types.push_back(col.GetType());
+		result->copy_state.postgres_types.push_back(postgres_table.postgres_types[columns[i].index]);
 	}
 	insert_types.push_back(LogicalType::VARCHAR);
 	result->insert_chunk.Initialize(context, insert_types);
+	if (small_dml_threshold > 0 && format == PostgresCopyFormat::BINARY) {
+		// parameters are sent in the binary format - this requires the same types as a binary copy
+		result->use_pipeline = true;
+		result->pipeline_state.Initialize(context);
+		result->pipeline_state.postgres_types = result->copy_state.postgres_types;
+		result->pipeline_sql = GetPipelinedUpdateSQL(postgres_table, columns);
+	}
 	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+static void WriteUpdateRows(PostgresCopyState &state, DataChunk &insert_chunk, idx_t column_count, row_t row_data[],
+                            idx_t count) {
+	// write the updated values followed by the ctid directly
+	PostgresBinaryWriter writer(state);
+	for (idx_t r = 0; r < count; r++) {
+		writer.BeginRow(column_count + 1);
+		for (idx_t c = 0; c < column_count; c++) {
+			writer.WriteValue(insert_chunk.data[c], r, &state.postgres_types[c]);
+		}
+		writer.WriteCTID(row_data[r]);
+		writer.FinishRow();
+	}
+}
+
 SinkResultType PostgresUpdate::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &gstate = input.global_state.Cast<PostgresUpdateGlobalState>();
 
@@ -121,38 +193,41 @@ SinkResultType PostgresUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 		auto &binding = expressions[i]->Cast<BoundReferenceExpression>();
 		gstate.insert_chunk.data[i].Reference(chunk.data[binding.index]);
 	}
-	// convert our row ids back into ctids
+	gstate.insert_chunk.SetCardinality(chunk);
 	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
-	auto &ctid_vector = gstate.insert_chunk.data[gstate.insert_chunk.ColumnCount() - 1];
 	auto row_data = FlatVector::GetData<row_t>(row_identifiers);
-	auto varchar_data = FlatVector::GetData<string_t>(ctid_vector);
-
-	for (idx_t r = 0; r < chunk.size(); r++) {
-		// extract the ctid from the row id
-		auto row_in_page = row_data[r] & 0xFFFF;
-		auto page_index = row_data[r] >> 16;
 
-		string ctid_string;
-		ctid_string += "'(";
-		ctid_string += to_string(page_index);
-		ctid_string += ",";
-		ctid_string += to_string(row_in_page);
-		ctid_string += ")'";
-		varchar_data[r] = StringVector::AddString(ctid_vector, ctid_string);
+	if (gstate.use_pipeline && gstate.pipeline_count + chunk.size() < small_dml_threshold) {
+		// small update - buffer the rows so they can be sent as pipelined statements
+		WriteUpdateRows(gstate.pipeline_state, gstate.insert_chunk, expressions.size(), row_data, chunk.size());
+		gstate.pipeline_count += chunk.size();
+		gstate.update_count += chunk.size();
+		return SinkResultType::NEED_MORE_INPUT;
 	}
-	gstate.insert_chunk.SetCardinality(chunk);
-
 	auto &transaction = PostgresTransaction::Get(context.client, gstate.table.catalog);
 	auto &connection = transaction.GetConnection();
 	if (!gstate.copy_is_active) {
 		// begin the COPY TO
-		string schema_name;
-		vector<string> column_names;
-		connection.BeginCopyTo(context.client, gstate.copy_state, PostgresCopyFormat::TEXT, schema_name,
-		                       gstate.update_table_name, column_names);
-		gstate.copy_is_active = true;
+		gstate.BeginCopyTo(context.client, connection);
+	}
+	if (gstate.format == PostgresCopyFormat::BINARY) {
+		WriteUpdateRows(gstate.copy_state, gstate.insert_chunk, expressions.size(), row_data, chunk.size());
+		connection.FlushCopyData(gstate.copy_state);
+	} else {
+		// convert our row ids back into ctids
+		auto &ctid_vector = gstate.insert_chunk.data[gstate.insert_chunk.ColumnCount() - 1];
+		auto varchar_data = FlatVector::GetData<string_t>(ctid_vector);
+		for (idx_t r = 0; r < chunk.size(); r++) {
+			// extract the ctid from the row id
+			auto row_in_page = row_data[r] & 0xFFFF;
+			auto page_index = row_data[r] >> 16;
+			char ctid_buffer[32];
+			auto ctid_length = snprintf(ctid_buffer, sizeof(ctid_buffer), "(%lld,%lld)",
+			                            static_cast<long long>(page_index), static_cast<long long>(row_in_page));
+			varchar_data[r] = StringVector::AddString(ctid_vector, ctid_buffer, NumericCast<idx_t>(ctid_length));
+		}
+		connection.CopyChunk(context.client, gstate.copy_state, gstate.insert_chunk, gstate.varchar_chunk);
 	}
-	connection.CopyChunk(context.client, gstate.copy_state, gstate.insert_chunk, gstate.varchar_chunk);
 	if (!keep_copy_alive) {
 		gstate.FinishCopyTo(connection);
 	}
@@ -168,6 +243,16 @@ SinkFinalizeType PostgresUpdate::Finalize(Pipeline &pipeline, Event &event, Clie
 	auto &gstate = input.global_state.Cast<PostgresUpdateGlobalState>();
 	auto &transaction = PostgresTransaction::Get(context, gstate.table.catalog);
 	auto &connection = transaction.GetConnection();
+	if (gstate.pipeline_count > 0) {
+		// small update - execute one UPDATE per row in a single round trip
+		auto &buffer = gstate.pipeline_state.buffer;
+		connection.ExecutePipelined(gstate.pipeline_sql, buffer.GetData(), buffer.GetPosition());
+		return SinkFinalizeType::READY;
+	}
+	if (!gstate.table_created) {
+		// no rows were updated
+		return SinkFinalizeType::READY;
+	}
 	gstate.FinishCopyTo(connection);
 	// merge the update_info table into the actual table (i.e. perform the actual update)
 	connection.Execute(gstate.update_sql);
@@ -207,9 +292,17 @@ PhysicalOperator &PostgresCatalog::PlanUpdate(ClientContext &context, PhysicalPl
 	if (op.return_chunk) {
 		throw BinderException("RETURNING clause not yet supported for updates of a Postgres table");
 	}
+	auto remote_update = PostgresDMLPushdown::TryPlanUpdate(context, planner, op);
+	if (remote_update) {
+		return *remote_update;
+	}
 
 	PostgresCatalog::MaterializePostgresScans(plan);
 	auto &update = planner.Make<PostgresUpdate>(op, op.table, std::move(op.columns), std::move(op.expressions));
+	Value small_dml_threshold;
+	if (context.TryGetCurrentSetting("pg_small_dml_threshold", small_dml_threshold)) {
+		update.small_dml_threshold = UBigIntValue::Get(small_dml_threshold);
+	}
 	update.children.push_back(plan);
 	return update;
 }